@@ -0,0 +1,96 @@
+#include <benchmark/benchmark.h>
+#include <comp/signal.hpp>
+#include <comp/utility/memory_pool.hpp>
+
+namespace
+{
+
+using SignalType = comp::Signal<void(int)>;
+
+void setup(SignalType& signal, bool usePool)
+{
+    if (usePool)
+    {
+        signal.setMemoryResource(comp::make_intrusive<comp::MemoryPool>());
+    }
+}
+
+}
+
+// Connects and disconnects a single slot at a time.
+void connectDisconnect(benchmark::State& state, bool usePool)
+{
+    SignalType signal;
+    setup(signal, usePool);
+
+    for (auto _ : state)
+    {
+        auto connection = signal.connect([](int) {});
+        connection.disconnect();
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK_CAPTURE(connectDisconnect, heap, false);
+BENCHMARK_CAPTURE(connectDisconnect, pool, true);
+
+// Connects a batch of slots, then disconnects them.
+void connectDisconnectBatch(benchmark::State& state, bool usePool)
+{
+    SignalType signal;
+    setup(signal, usePool);
+    const auto count = size_t(state.range(0));
+    std::vector<comp::Connection> connections;
+    connections.reserve(count);
+
+    for (auto _ : state)
+    {
+        for (auto i = 0u; i < count; ++i)
+        {
+            connections.push_back(signal.connect([](int) {}));
+        }
+        for (auto& connection : connections)
+        {
+            connection.disconnect();
+        }
+        connections.clear();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK_CAPTURE(connectDisconnectBatch, heap, false)->Range(8, 1024);
+BENCHMARK_CAPTURE(connectDisconnectBatch, pool, true)->Range(8, 1024);
+
+// Connects a slot with a tracker, then disconnects it.
+void connectTrackedDisconnect(benchmark::State& state, bool usePool)
+{
+    SignalType signal;
+    setup(signal, usePool);
+    auto tracker = comp::make_shared<int>(0);
+
+    for (auto _ : state)
+    {
+        auto connection = signal.connect([](int) {}).bind(tracker);
+        connection.disconnect();
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK_CAPTURE(connectTrackedDisconnect, heap, false);
+BENCHMARK_CAPTURE(connectTrackedDisconnect, pool, true);
+
+// Connects a batch of slots to a signal, then destroys the signal.
+void destroySignal(benchmark::State& state, bool usePool)
+{
+    const auto count = size_t(state.range(0));
+
+    for (auto _ : state)
+    {
+        SignalType signal;
+        setup(signal, usePool);
+        for (auto i = 0u; i < count; ++i)
+        {
+            signal.connect([](int) {});
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK_CAPTURE(destroySignal, heap, false)->Range(8, 4096);
+BENCHMARK_CAPTURE(destroySignal, pool, true)->Range(8, 4096);
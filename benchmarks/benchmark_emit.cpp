@@ -0,0 +1,247 @@
+#include <benchmark/benchmark.h>
+#include <comp/collectors.hpp>
+#include <comp/signal.hpp>
+#include <comp/static_signal.hpp>
+#include <comp/utility/event_loop.hpp>
+
+namespace
+{
+
+using SignalType = comp::Signal<void(int)>;
+
+void function(int value)
+{
+    benchmark::DoNotOptimize(value);
+}
+
+class Receiver : public comp::enable_shared_from_this<Receiver>
+{
+public:
+    void method(int value)
+    {
+        benchmark::DoNotOptimize(value);
+    }
+};
+
+class TrackerObject : public comp::ConnectionTracker
+{
+};
+
+void emit(benchmark::State& state, SignalType& signal)
+{
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(signal(1));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+}
+
+// Emits a signal connected to functions.
+void emitFunction(benchmark::State& state)
+{
+    SignalType signal;
+    for (auto i = 0; i < state.range(0); ++i)
+    {
+        signal.connect(&function);
+    }
+    emit(state, signal);
+}
+BENCHMARK(emitFunction)->RangeMultiplier(4)->Range(1, 1024);
+
+// Emits a static signal with four functions. Compare with emitFunction/4.
+void emitStatic(benchmark::State& state)
+{
+    comp::StaticSignal<void(int), &function, &function, &function, &function> signal;
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(signal(1));
+    }
+    state.SetItemsProcessed(state.iterations() * signal.size());
+}
+BENCHMARK(emitStatic);
+
+// Emits a signal connected to lambdas.
+void emitLambda(benchmark::State& state)
+{
+    SignalType signal;
+    for (auto i = 0; i < state.range(0); ++i)
+    {
+        signal.connect([](int value) { benchmark::DoNotOptimize(value); });
+    }
+    emit(state, signal);
+}
+BENCHMARK(emitLambda)->RangeMultiplier(4)->Range(1, 1024);
+
+// Emits a signal connected to methods. Method slots are tracked by their receiver.
+void emitMethod(benchmark::State& state)
+{
+    SignalType signal;
+    auto receiver = comp::make_shared<Receiver>();
+    for (auto i = 0; i < state.range(0); ++i)
+    {
+        signal.connect(receiver, &Receiver::method);
+    }
+    emit(state, signal);
+}
+BENCHMARK(emitMethod)->RangeMultiplier(4)->Range(1, 1024);
+
+// Emits a signal connected to signals, each having a function connected.
+void emitSignal(benchmark::State& state)
+{
+    SignalType signal;
+    std::vector<std::unique_ptr<SignalType>> receivers;
+    for (auto i = 0; i < state.range(0); ++i)
+    {
+        receivers.push_back(std::make_unique<SignalType>());
+        receivers.back()->connect(&function);
+        signal.connect(*receivers.back());
+    }
+    emit(state, signal);
+}
+BENCHMARK(emitSignal)->RangeMultiplier(4)->Range(1, 1024);
+
+// Emits a batch of 64 events to a signal connected to lambdas. Compare with emitLambda.
+void emitBatch(benchmark::State& state)
+{
+    SignalType signal;
+    for (auto i = 0; i < state.range(0); ++i)
+    {
+        signal.connect([](int value) { benchmark::DoNotOptimize(value); });
+    }
+    const std::vector<std::tuple<int>> events(64u, std::tuple<int>(1));
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(signal.emitBatch(events));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0) * events.size());
+}
+BENCHMARK(emitBatch)->RangeMultiplier(4)->Range(1, 1024);
+
+// Emits a batch of 64 events to a batch slot.
+void emitBatchSlot(benchmark::State& state)
+{
+    SignalType signal;
+    signal.connectBatch([](comp::signal_batch_t<int> events)
+    {
+        for (auto& event : events)
+        {
+            benchmark::DoNotOptimize(std::get<0>(event));
+        }
+    });
+    const std::vector<std::tuple<int>> events(64u, std::tuple<int>(1));
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(signal.emitBatch(events));
+    }
+    state.SetItemsProcessed(state.iterations() * events.size());
+}
+BENCHMARK(emitBatchSlot);
+
+// Emits a signal connected to lambdas with queued connections, then delivers the events on the same thread.
+void emitQueued(benchmark::State& state)
+{
+    SignalType signal;
+    comp::EventLoop loop;
+    for (auto i = 0; i < state.range(0); ++i)
+    {
+        signal.connect(loop, [](int value) { benchmark::DoNotOptimize(value); });
+    }
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(signal(1));
+        loop.processEvents();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(emitQueued)->RangeMultiplier(4)->Range(1, 1024);
+
+// Emits a signal connected to lambdas that are bound to a shared pointer.
+void emitTrackedBySharedPtr(benchmark::State& state)
+{
+    SignalType signal;
+    auto tracker = comp::make_shared<int>(0);
+    for (auto i = 0; i < state.range(0); ++i)
+    {
+        signal.connect([](int value) { benchmark::DoNotOptimize(value); }).bind(tracker);
+    }
+    emit(state, signal);
+}
+BENCHMARK(emitTrackedBySharedPtr)->RangeMultiplier(4)->Range(1, 1024);
+
+// Emits a signal connected to lambdas that are bound to a connection tracker.
+void emitTrackedByTracker(benchmark::State& state)
+{
+    SignalType signal;
+    TrackerObject tracker;
+    for (auto i = 0; i < state.range(0); ++i)
+    {
+        signal.connect([](int value) { benchmark::DoNotOptimize(value); }).bind(&tracker);
+    }
+    emit(state, signal);
+}
+BENCHMARK(emitTrackedByTracker)->RangeMultiplier(4)->Range(1, 1024);
+
+// Emits a signal with return value, collecting the results with the default collector.
+void emitDefaultCollector(benchmark::State& state)
+{
+    comp::Signal<int(int)> signal;
+    for (auto i = 0; i < state.range(0); ++i)
+    {
+        signal.connect([](int value) { return value; });
+    }
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(signal(1));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(emitDefaultCollector)->RangeMultiplier(4)->Range(1, 1024);
+
+// Emits a signal with return value, summing the results with a collector.
+void emitSumCollector(benchmark::State& state)
+{
+    comp::Signal<int(int)> signal;
+    for (auto i = 0; i < state.range(0); ++i)
+    {
+        signal.connect([](int value) { return value; });
+    }
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(signal.operator()<comp::SumCollector<int>>(1).get());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(emitSumCollector)->RangeMultiplier(4)->Range(1, 1024);
+
+// Emits a signal with return value, collecting the results into a default collector reused across emissions.
+void emitReusedCollector(benchmark::State& state)
+{
+    comp::Signal<int(int)> signal;
+    for (auto i = 0; i < state.range(0); ++i)
+    {
+        signal.connect([](int value) { return value; });
+    }
+    comp::DefaultSignalCollector<int> results;
+    for (auto _ : state)
+    {
+        results.clear();
+        benchmark::DoNotOptimize(signal.emit(results, 1).data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(emitReusedCollector)->RangeMultiplier(4)->Range(1, 1024);
+
+// Emits a blocked signal.
+void emitBlocked(benchmark::State& state)
+{
+    SignalType signal;
+    signal.connect(&function);
+    signal.setBlocked(true);
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(signal(1));
+    }
+}
+BENCHMARK(emitBlocked);
@@ -0,0 +1,128 @@
+#include <benchmark/benchmark.h>
+#include <comp/sharded_signal.hpp>
+#include <comp/signal.hpp>
+#include <comp/utility/thread_pool.hpp>
+
+#ifdef COMP_CONFIG_THREAD_ENABLED
+
+namespace
+{
+
+using SignalType = comp::Signal<void(int)>;
+
+constexpr int slotCount = 64;
+
+SignalType* signal = nullptr;
+
+void setup(const benchmark::State& state)
+{
+    if (state.thread_index() == 0)
+    {
+        signal = new SignalType;
+        for (auto i = 0; i < slotCount; ++i)
+        {
+            signal->connect([](int value) { benchmark::DoNotOptimize(value); });
+        }
+    }
+}
+
+void teardown(const benchmark::State& state)
+{
+    if (state.thread_index() == 0)
+    {
+        delete signal;
+        signal = nullptr;
+    }
+}
+
+}
+
+// Emits the same signal from multiple threads.
+void emitContention(benchmark::State& state)
+{
+    setup(state);
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize((*signal)(1));
+    }
+    state.SetItemsProcessed(state.iterations() * slotCount);
+    teardown(state);
+}
+BENCHMARK(emitContention)->ThreadRange(1, 8)->UseRealTime();
+
+// Emits the signal from the first thread, while the other threads connect and disconnect slots.
+void emitConnectContention(benchmark::State& state)
+{
+    setup(state);
+    for (auto _ : state)
+    {
+        if (state.thread_index() == 0)
+        {
+            benchmark::DoNotOptimize((*signal)(1));
+        }
+        else
+        {
+            auto connection = signal->connect([](int value) { benchmark::DoNotOptimize(value); });
+            connection.disconnect();
+        }
+    }
+    state.SetItemsProcessed(state.iterations());
+    teardown(state);
+}
+BENCHMARK(emitConnectContention)->ThreadRange(2, 8)->UseRealTime();
+
+// Connects and disconnects slots from multiple threads.
+void connectContention(benchmark::State& state)
+{
+    setup(state);
+    for (auto _ : state)
+    {
+        auto connection = signal->connect([](int value) { benchmark::DoNotOptimize(value); });
+        connection.disconnect();
+    }
+    state.SetItemsProcessed(state.iterations());
+    teardown(state);
+}
+BENCHMARK(connectContention)->ThreadRange(1, 8)->UseRealTime();
+
+// Connects and disconnects slots from multiple threads on a sharded signal.
+void shardedConnectContention(benchmark::State& state)
+{
+    static comp::ShardedSignal<void(int)>* shardedSignal = nullptr;
+    if (state.thread_index() == 0)
+    {
+        shardedSignal = new comp::ShardedSignal<void(int)>;
+    }
+    for (auto _ : state)
+    {
+        auto connection = shardedSignal->connect([](int value) { benchmark::DoNotOptimize(value); });
+        connection.disconnect();
+    }
+    state.SetItemsProcessed(state.iterations());
+    if (state.thread_index() == 0)
+    {
+        delete shardedSignal;
+        shardedSignal = nullptr;
+    }
+}
+BENCHMARK(shardedConnectContention)->ThreadRange(1, 8)->UseRealTime();
+
+// Emits a signal asynchronously on a thread pool with a growing number of worker threads, and waits for
+// the emission to complete.
+void emitAsync(benchmark::State& state)
+{
+    comp::ThreadPool pool(size_t(state.range(0)));
+    SignalType signal;
+    for (auto i = 0; i < slotCount; ++i)
+    {
+        signal.connect([](int value) { benchmark::DoNotOptimize(value); });
+    }
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(signal.emitAsync(pool, 1).get());
+    }
+    state.SetItemsProcessed(state.iterations() * slotCount);
+}
+BENCHMARK(emitAsync)->RangeMultiplier(2)->Range(1, 8)->UseRealTime();
+
+#endif
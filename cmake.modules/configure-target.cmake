@@ -1,6 +1,12 @@
 include(configure-platform)
 
 option(COMP_THREAD_SAFE "Build with threads safe." OFF)
+option(COMP_COROUTINES "Build with C++20 coroutine support." OFF)
+option(COMP_INSTRUMENTATION "Build with signal instrumentation." OFF)
+
+if (COMP_COROUTINES AND CMAKE_CXX_STANDARD LESS 20)
+    set(CMAKE_CXX_STANDARD 20 CACHE STRING "C++ standard" FORCE)
+endif()
 
 # local function, configure common options
 macro(__common_config arg_target)
@@ -26,8 +32,16 @@ macro(__common_config arg_target)
         target_compile_options(${arg_target} PUBLIC -pthread)
     endif()
 
+    if (COMP_COROUTINES)
+        target_compile_definitions(${arg_target} PUBLIC COMP_CONFIG_COROUTINES_ENABLED)
+    endif()
+
+    if (COMP_INSTRUMENTATION)
+        target_compile_definitions(${arg_target} PUBLIC COMP_CONFIG_INSTRUMENTATION_ENABLED)
+    endif()
+
     # compile options
-    target_compile_options(${arg_target} PUBLIC -std=c++17 -Werror -Wall -W -fPIC)
+    target_compile_options(${arg_target} PUBLIC -std=c++${CMAKE_CXX_STANDARD} -Werror -Wall -W -fPIC)
 
     if ("${CMAKE_CXX_COMPILER_ID}" STREQUAL "Clang")
         target_compile_options(${arg_target} PUBLIC -stdlib=libc++ -Winconsistent-missing-override)
@@ -11,7 +11,7 @@ int main()
 {
     comp::Signal<void()> signal;
 
-    auto object = comp::make_shared<comp::ConnectionTracker, Object>();
+    comp::shared_ptr<comp::ConnectionTracker> object = comp::make_shared<Object>();
 
     // Note: capture shared objects as weak pointer!
     auto slot = [weakObject = comp::weak_ptr<comp::ConnectionTracker>(object)]()
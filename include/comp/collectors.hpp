@@ -0,0 +1,239 @@
+#ifndef COMP_COLLECTORS_HPP
+#define COMP_COLLECTORS_HPP
+
+#include <comp/config.hpp>
+#include <comp/concept/signal.hpp>
+#include <comp/wrap/optional.hpp>
+
+namespace comp
+{
+
+/// Sums the results of the slots. The reducing collectors of this header fold the results of the slots as
+/// the slots are activated, without storing the results, and count the results they folded.
+/// \tparam T The return type of the signal.
+template <typename T>
+class COMP_TEMPLATE_API SumCollector : public Collector<SumCollector<T>>
+{
+public:
+    /// Handles the result.
+    bool handleResult(ConnectionView, const T& result)
+    {
+        m_sum += result;
+        ++m_count;
+        return true;
+    }
+
+    /// Returns the sum of the results. If no slot was activated, returns the value initialized \e T.
+    const T& get() const
+    {
+        return m_sum;
+    }
+
+    /// Returns the number of results summed.
+    size_t size() const
+    {
+        return m_count;
+    }
+
+private:
+    T m_sum = T();
+    size_t m_count = 0u;
+};
+
+/// Keeps the smallest result of the slots. Of the equal results, keeps the first.
+/// \tparam T The return type of the signal.
+template <typename T>
+class COMP_TEMPLATE_API MinCollector : public Collector<MinCollector<T>>
+{
+public:
+    /// Handles the result.
+    bool handleResult(ConnectionView, const T& result)
+    {
+        if (!m_min || result < *m_min)
+        {
+            m_min = result;
+        }
+        ++m_count;
+        return true;
+    }
+
+    /// Returns the smallest result. If no slot was activated, returns an empty optional.
+    const optional<T>& get() const
+    {
+        return m_min;
+    }
+
+    /// Returns the number of results compared.
+    size_t size() const
+    {
+        return m_count;
+    }
+
+private:
+    optional<T> m_min;
+    size_t m_count = 0u;
+};
+
+/// Keeps the largest result of the slots. Of the equal results, keeps the first.
+/// \tparam T The return type of the signal.
+template <typename T>
+class COMP_TEMPLATE_API MaxCollector : public Collector<MaxCollector<T>>
+{
+public:
+    /// Handles the result.
+    bool handleResult(ConnectionView, const T& result)
+    {
+        if (!m_max || *m_max < result)
+        {
+            m_max = result;
+        }
+        ++m_count;
+        return true;
+    }
+
+    /// Returns the largest result. If no slot was activated, returns an empty optional.
+    const optional<T>& get() const
+    {
+        return m_max;
+    }
+
+    /// Returns the number of results compared.
+    size_t size() const
+    {
+        return m_count;
+    }
+
+private:
+    optional<T> m_max;
+    size_t m_count = 0u;
+};
+
+/// Keeps the result of the last slot activated.
+/// \tparam T The return type of the signal.
+template <typename T>
+class COMP_TEMPLATE_API LastCollector : public Collector<LastCollector<T>>
+{
+public:
+    /// Handles the result.
+    bool handleResult(ConnectionView, const T& result)
+    {
+        m_last = result;
+        ++m_count;
+        return true;
+    }
+
+    /// Returns the result of the last slot. If no slot was activated, returns an empty optional.
+    const optional<T>& get() const
+    {
+        return m_last;
+    }
+
+    /// Returns the number of results handled.
+    size_t size() const
+    {
+        return m_count;
+    }
+
+private:
+    optional<T> m_last;
+    size_t m_count = 0u;
+};
+
+/// Keeps the first result of the slots that converts to \e true, such as a non-null pointer or a non-empty
+/// optional. The emission stops at that result, the rest of the slots are not activated.
+/// \tparam T The return type of the signal.
+template <typename T>
+class COMP_TEMPLATE_API FirstNonNullCollector : public Collector<FirstNonNullCollector<T>>
+{
+public:
+    /// Handles the result.
+    bool handleResult(ConnectionView, const T& result)
+    {
+        ++m_count;
+        if (!static_cast<bool>(result))
+        {
+            return true;
+        }
+        m_first = result;
+        return false;
+    }
+
+    /// Returns the first non-null result. If no slot returned a non-null result, returns the value
+    /// initialized \e T.
+    const T& get() const
+    {
+        return m_first;
+    }
+
+    /// Returns the number of results handled.
+    size_t size() const
+    {
+        return m_count;
+    }
+
+private:
+    T m_first = T();
+    size_t m_count = 0u;
+};
+
+/// Checks whether any slot returns \e true. The emission stops at the first slot that returns \e true.
+class COMP_API AnyCollector : public Collector<AnyCollector>
+{
+public:
+    /// Handles the result.
+    bool handleResult(ConnectionView, bool result)
+    {
+        ++m_count;
+        m_any = m_any || result;
+        return !result;
+    }
+
+    /// Returns \e true if a slot returned \e true. If no slot was activated, returns \e false.
+    bool get() const
+    {
+        return m_any;
+    }
+
+    /// Returns the number of results handled.
+    size_t size() const
+    {
+        return m_count;
+    }
+
+private:
+    bool m_any = false;
+    size_t m_count = 0u;
+};
+
+/// Checks whether all the slots return \e true. The emission stops at the first slot that returns \e false.
+class COMP_API AllCollector : public Collector<AllCollector>
+{
+public:
+    /// Handles the result.
+    bool handleResult(ConnectionView, bool result)
+    {
+        ++m_count;
+        m_all = m_all && result;
+        return result;
+    }
+
+    /// Returns \e true if all the slots returned \e true. If no slot was activated, returns \e true.
+    bool get() const
+    {
+        return m_all;
+    }
+
+    /// Returns the number of results handled.
+    size_t size() const
+    {
+        return m_count;
+    }
+
+private:
+    bool m_all = true;
+    size_t m_count = 0u;
+};
+
+} // namespace comp
+
+#endif // COMP_COLLECTORS_HPP
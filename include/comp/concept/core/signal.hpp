@@ -2,10 +2,15 @@
 #define COMP_SIGNAL_CORE_HPP
 
 #include <comp/config.hpp>
+#include <comp/utility/instrumentation.hpp>
 #include <comp/utility/lockable.hpp>
 #include <comp/utility/tracker.hpp>
+#include <comp/wrap/atomic.hpp>
+#include <comp/wrap/intrusive_ptr.hpp>
 #include <comp/wrap/memory.hpp>
 #include <comp/wrap/mutex.hpp>
+#include <comp/wrap/thread.hpp>
+#include <comp/wrap/utility.hpp>
 #include <comp/wrap/vector.hpp>
 
 namespace comp {
@@ -14,21 +19,169 @@ class Connection;
 
 namespace core {
 
+template <typename LockType>
+class Slot;
+
 /// Core of the signals.
 class COMP_API Signal
 {
+    template <typename LockType>
+    friend class Slot;
+
 public:
-    /// Destructor.
-    virtual ~Signal() = default;
+    /// Destructor. Marks the emissions of the signal on the calling thread, so an emission destroying its signal
+    /// from a slot stops.
+    virtual ~Signal()
+    {
+        for (auto guard = EmitGuard::current; guard; guard = guard->m_previous)
+        {
+            if (guard->m_signal == this)
+            {
+                guard->m_signal = nullptr;
+            }
+        }
+    }
 
     /// Disconnects a \a connection.
     /// \param connection The connection to disconnect.
     virtual void disconnect(Connection connection) = 0;
+
+    /// Returns the memory resource used to allocate the slots and the trackers of the signal.
+    /// \return The memory resource of the signal. If \e nullptr, the slots and trackers are allocated from the
+    /// global heap.
+    const MemoryResourcePtr& getMemoryResource() const
+    {
+        return m_memoryResource;
+    }
+
+    /// Sets the memory \a resource used to allocate the slots and the trackers of the signal. Set the memory
+    /// resource before connecting slots to the signal. The slots connected already are not affected.
+    /// \param resource The memory resource to use, for instance a MemoryPool. Pass \e nullptr to use the global heap.
+    void setMemoryResource(MemoryResourcePtr resource)
+    {
+        m_memoryResource = resource;
+    }
+
+    /// Checks whether the signal is emitted on the calling thread.
+    /// \return If the signal is emitted on the calling thread, returns \e true, otherwise \e false.
+    bool isEmittingOnCurrentThread() const
+    {
+        for (auto guard = EmitGuard::current; guard; guard = guard->m_previous)
+        {
+            if (guard->m_signal == this)
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+#ifdef COMP_CONFIG_INSTRUMENTATION_ENABLED
+    /// Returns the statistics of the signal. The slots of the signal share the statistics.
+    /// \return The statistics of the signal.
+    const SignalStatisticsPtr& getStatistics() const
+    {
+        return m_statistics;
+    }
+#endif
+
+protected:
+    /// Marks a signal as emitted on the calling thread for the lifetime of the guard. The guards of a thread
+    /// form a stack, where each emission nested in a slot activation pushes a new guard. Signals can be emitted
+    /// concurrently from different threads, while the re-entrancy protection is kept per thread.
+    class COMP_API EmitGuard
+    {
+        friend class Signal;
+
+        static inline thread_local EmitGuard* current = nullptr;
+        const Signal* m_signal = nullptr;
+        EmitGuard* m_previous = nullptr;
+
+        COMP_DISABLE_COPY_OR_MOVE(EmitGuard)
+
+    public:
+        /// Constructor, pushes the guard of the \a signal to the calling thread's emission stack.
+        explicit EmitGuard(const Signal& signal)
+            : m_signal(&signal)
+            , m_previous(current)
+        {
+            current = this;
+        }
+        /// Destructor, pops the guard from the calling thread's emission stack.
+        ~EmitGuard()
+        {
+            COMP_ASSERT(current == this);
+            current = m_previous;
+        }
+
+        /// Returns whether the signal of the guard was destroyed during the emission. Do not touch the signal
+        /// once destroyed.
+        bool isSignalDestroyed() const
+        {
+            return !m_signal;
+        }
+    };
+
+    /// Called by a \a slot of the signal when the slot gets disconnected. The disconnected slot stays in the signal
+    /// until the signal removes it.
+    virtual void notifySlotDisconnected(Slot<mutex>& slot)
+    {
+        COMP_UNUSED(slot);
+    }
+
+private:
+    MemoryResourcePtr m_memoryResource;
+#ifdef COMP_CONFIG_INSTRUMENTATION_ENABLED
+    SignalStatisticsPtr m_statistics = make_shared<SignalStatistics>();
+#endif
+};
+
+/// The header of the block that holds a slot. The header holds the reference counts and the state of the slot,
+/// and precedes the slot in the block. The slot is destroyed when its strong references are released, while
+/// the header is kept until the weak references are released too, so the state of a destroyed slot reads
+/// disconnected.
+struct COMP_API SlotHeader
+{
+    /// The number of strong references to the slot.
+    atomic<uint32_t> strongCount = 1u;
+    /// The number of weak references to the slot, plus one held by the strong references.
+    atomic<uint32_t> weakCount = 1u;
+    /// The state of the slot, see Slot::StateFlags. The slot is created connected.
+    atomic<size_t> state = 0x1;
+    /// The memory resource the block is allocated from, \e nullptr if allocated from the global heap.
+    MemoryResource* resource = nullptr;
+    /// The size of the block.
+    uint32_t size = 0u;
+    /// The readers walking the trackers of the slot without locking, see Slot::TrackerReaderFlags.
+    atomic<uint32_t> trackerReaders = 0u;
+
+    /// The offset of the slot in the block.
+    static constexpr size_t slotOffset()
+    {
+        return SharedBlock::alignedSize(sizeof(SlotHeader));
+    }
+
+    /// Releases a weak reference. Releases the block when no references are left.
+    void releaseWeak()
+    {
+        if (weakCount.fetch_sub(1u, memory_order_acq_rel) == 1u)
+        {
+            auto memoryResource = resource;
+            const auto blockSize = size;
+            this->~SlotHeader();
+            SharedBlock::deallocate(memoryResource, this, blockSize);
+            if (memoryResource)
+            {
+                intrusive_ptr_release(memoryResource);
+            }
+        }
+    }
 };
 
-/// Core of the slots.
+/// Core of the slots. The slots are reference counted intrusively: the strong references are held by
+/// intrusive_ptr<>, the weak references by Connection. Create the slots with create().
 template <typename LockType>
-class COMP_API Slot : public Lockable<LockType>, public enable_shared_from_this<Slot<LockType>>
+class COMP_API Slot : public Lockable<LockType>
 {
 public:
     /// ConnectionTracker interface.
@@ -37,28 +190,186 @@ public:
         /// Destructor.
         virtual ~TrackerInterface() = default;
 
-        /// Detaches a slot from a tracker.
-        virtual void untrack() = 0;
+        /// Returns the ConnectionTracker the slot is linked to by the tracker.
+        /// \return The ConnectionTracker of the tracker. If the tracker does not link the slot to a ConnectionTracker,
+        /// returns \e nullptr.
+        virtual const void* getConnectionTracker() const = 0;
 
         /// Returns the valid state of a tracker. A tracker is valid when it tracks a valid object.
         /// \return If the tracker is valid, returns \e true, otherwise \e false.
         virtual bool isValid() const = 0;
+
+        /// Returns whether the slot polls the valid state of the tracker. Trackers that disconnect the slot
+        /// when the tracked object is destroyed need no polling.
+        /// \return If the slot polls the tracker, returns \e true, otherwise \e false.
+        virtual bool isPolled() const = 0;
+
+        /// Returns the size of the tracker object.
+        virtual size_t getSize() const = 0;
+
+        /// The next tracker of the slot. The trackers are walked without locking.
+        atomic<TrackerInterface*> next = nullptr;
+    };
+
+    /// The size of the storage of the tracker held in place in the slot. The storage fits the first tracker
+    /// bound to the slot, up to the tracker of a shared ConnectionTracker, the largest tracker of the library.
+    /// The other trackers are allocated from the memory resource of the slot.
+    static constexpr size_t inlineTrackerSize = 8u * sizeof(void*);
+
+    /// Destructor, destroys the trackers of the slot.
+    virtual ~Slot()
+    {
+        clearTrackers();
+    }
+
+    /// Creates a slot of \a Derived type in a block allocated from a memory \a resource. The block holds the
+    /// reference counts of the slot in front of the slot.
+    /// \param resource The memory resource to allocate the slot from. If \e nullptr, the slot is allocated
+    ///        from the global heap.
+    /// \param arguments The arguments passed to the constructor of the \a Derived type.
+    /// \return The intrusive pointer to the created slot.
+    template <class Derived, class... Arguments>
+    static intrusive_ptr<Slot> create(const MemoryResourcePtr& resource, Arguments&&... arguments);
+
+    /// Adds a strong reference to the slot.
+    void retain()
+    {
+        getHeader().strongCount.fetch_add(1u, memory_order_relaxed);
+    }
+
+    /// Adds a strong reference to the slot, if the slot is not destroyed. Call it with a weak reference held.
+    /// \return If the reference is added, returns \e true, otherwise \e false.
+    bool tryRetain();
+
+    /// Releases a strong reference. Destroys the slot when the last strong reference is released.
+    void release();
+
+    /// Adds a weak reference to the slot.
+    void retainWeak()
+    {
+        getHeader().weakCount.fetch_add(1u, memory_order_relaxed);
+    }
+
+    /// Releases a weak reference to the slot.
+    void releaseWeak()
+    {
+        getHeader().releaseWeak();
+    }
+
+    /// The state of the slot. The lowest bits hold the state flags, the rest of the bits hold the number of
+    /// in-flight activations.
+    enum StateFlags : size_t
+    {
+        /// The slot is connected.
+        Connected = 0x1,
+        /// The slot has trackers that are polled.
+        Polled = 0x2,
+        /// The slot has a receiver that is checked without a tracker, see isReceiverValid().
+        Receiver = 0x4,
+        /// The unit of the activation counter.
+        ActivationUnit = 0x8
     };
-    using TrackerPtr = shared_ptr<TrackerInterface>;
 
-    virtual ~Slot() = default;
+    /// The readers of the trackers register in one of two counters, selected by the epoch bit. The writers
+    /// that remove trackers flip the epoch, and wait for the readers of the previous epoch.
+    enum TrackerReaderFlags : uint32_t
+    {
+        /// The unit of the reader counter of the even epochs.
+        EvenReaderUnit = 0x1,
+        /// The reader counter of the even epochs.
+        EvenReaderMask = 0x7fff,
+        /// The unit of the reader counter of the odd epochs.
+        OddReaderUnit = 0x10000,
+        /// The reader counter of the odd epochs.
+        OddReaderMask = 0x7fff0000,
+        /// The epoch bit.
+        OddEpoch = 0x80000000
+    };
 
-    /// Checks whether a slot is connected.
+    /// Returns the state of the slot. The state is readable with a weak reference to the slot held, after
+    /// the slot is destroyed.
+    /// \return The state of the slot.
+    size_t getState() const
+    {
+        return getHeader().state.load(memory_order_relaxed);
+    }
+
+    /// Checks whether a slot is connected. Unless the slot has trackers that are polled, or a receiver, the
+    /// check is a single atomic load. The check takes no lock.
     /// \return If the slot is connected, returns \e true, otherwise returns \e false.
     bool isConnected() const;
 
-    /// Disconnects a slot.
-    void disconnect();
+    /// Checks whether the slot is detached from its signal. Unlike isConnected(), the method does not check
+    /// the trackers of the slot. A slot with an invalid tracker is detached when the slot gets disconnected.
+    /// \return If the slot is detached, returns \e true, otherwise returns \e false.
+    bool isDetached() const
+    {
+        return (getHeader().state.load() & Connected) != Connected;
+    }
+
+    /// Returns the signal the slot is connected to.
+    /// \return The signal of the slot. If the slot is disconnected, returns \e nullptr.
+    Signal* getSignal();
 
-    /// Adds a tracker to the slot.
-    /// \param tracker The tracker to add to the slot.
+    /// Disconnects a slot. The slot may still be activated by the emitters that started its activation before
+    /// the disconnect. To wait for those activations to complete, pass \e true to \a waitForActivations. Do not
+    /// wait for the activations from within the slot, as that never completes.
+    /// \param waitForActivations If \e true, the call returns after the in-flight activations of the slot complete.
+    void disconnect(bool waitForActivations = false);
+
+    /// Marks the slot activated for the lifetime of the guard. The activation state is kept in the same atomic
+    /// word as the connected state, so activating a slot takes no lock.
+    class COMP_API ActivationGuard
+    {
+        Slot& m_slot;
+        bool m_isActive = false;
+
+        COMP_DISABLE_COPY_OR_MOVE(ActivationGuard)
+
+    public:
+        /// Constructor, marks the \a slot activated if the slot is connected.
+        explicit ActivationGuard(Slot& slot)
+            : m_slot(slot)
+        {
+            const auto state = m_slot.getHeader().state.fetch_add(ActivationUnit);
+            m_isActive = (state & Connected) == Connected;
+            if (!m_isActive)
+            {
+                m_slot.getHeader().state.fetch_sub(ActivationUnit);
+            }
+        }
+        /// Destructor, completes the activation.
+        ~ActivationGuard()
+        {
+            if (m_isActive)
+            {
+                m_slot.getHeader().state.fetch_sub(ActivationUnit);
+            }
+        }
+
+        /// Returns whether the slot was connected when the guard was created.
+        operator bool() const
+        {
+            return m_isActive;
+        }
+    };
+
+    /// Creates a tracker of \a TrackerType in the slot. The tracker is created in the storage of the slot if it
+    /// fits the storage and the storage is free, otherwise it is allocated from the memory resource of the slot.
+    /// \param arguments The arguments passed to the constructor of the tracker.
     /// \see Connection::bind()
-    void addTracker(TrackerPtr tracker);
+    template <class TrackerType, class... Arguments>
+    void addTracker(Arguments&&... arguments);
+
+    /// Removes the trackers that link the slot to a \a connectionTracker. The slot stays connected.
+    /// \param connectionTracker The ConnectionTracker to detach the slot from.
+    /// \see Tracker<Connection>::untrack()
+    void removeTracker(const void* connectionTracker);
+
+    /// Returns the memory resource of the signal the slot is connected to.
+    /// \return The memory resource of the signal. Returns \e nullptr if the slot is disconnected, or if the signal
+    /// allocates from the global heap.
+    MemoryResourcePtr getMemoryResource();
 
 protected:
     /// Constructor.
@@ -67,22 +378,68 @@ protected:
     {
     }
 
+    /// Returns the header of the block that holds the slot.
+    SlotHeader& getHeader() const
+    {
+        return *reinterpret_cast<SlotHeader*>(reinterpret_cast<char*>(const_cast<Slot*>(this)) - SlotHeader::slotOffset());
+    }
+
     /// To implement slot specific disconnect function, override this method.
     virtual void disconnectOverride()
     {
     }
 
-    /// The container with the binded trackers.
-    using TrackersContainer = vector<TrackerPtr>;
-    TrackersContainer m_trackers;
+    /// Slots with a receiver override this method to report whether the receiver is alive. The slots set the
+    /// Receiver flag to get the method called.
+    virtual bool isReceiverValid() const
+    {
+        return true;
+    }
+
+    /// Sets state \a flags on the slot.
+    void setStateFlags(size_t flags)
+    {
+        getHeader().state.fetch_or(flags);
+    }
+
+    /// Walks the trackers of the slot without locking, and checks whether they are valid.
+    bool areTrackersValid() const;
+
+    /// Waits for the readers that may walk the trackers unlinked before the call. Call it with the slot locked.
+    void waitForTrackerReaders();
+
+    /// Destroys the binded trackers. Call it with the slot locked.
+    void clearTrackers();
+
+    /// Destroys a \a tracker that is unlinked from the trackers of the slot.
+    void destroyTracker(TrackerInterface* tracker);
+
+    /// Returns whether the storage of the tracker held in place is free.
+    bool isTrackerStorageFree() const;
+
+    /// The binded trackers, in a singly linked list. Modified with the slot locked, read without locking.
+    atomic<TrackerInterface*> m_trackers = nullptr;
+    /// The storage of the tracker held in place.
+    alignas(TrackerInterface) unsigned char m_trackerStorage[inlineTrackerSize];
 
     /// The signal to which the slot connects.
     Signal* m_signal = nullptr;
-
-    /// The connected state.
-    atomic_bool m_isConnected = true;
 };
 
+/// Adds a strong reference to a \a slot held by an intrusive_ptr<>.
+template <typename LockType>
+void intrusive_ptr_add_ref(Slot<LockType>* slot)
+{
+    slot->retain();
+}
+
+/// Releases a strong reference to a \a slot held by an intrusive_ptr<>.
+template <typename LockType>
+void intrusive_ptr_release(Slot<LockType>* slot)
+{
+    slot->release();
+}
+
 }} // comp::core
 
 #endif // COMP_SIGNAL_CORE_HPP
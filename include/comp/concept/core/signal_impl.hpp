@@ -5,57 +5,267 @@
 
 namespace comp { namespace core {
 
+template <typename LockType>
+template <class Derived, class... Arguments>
+intrusive_ptr<Slot<LockType>> Slot<LockType>::create(const MemoryResourcePtr& resource, Arguments&&... arguments)
+{
+    static_assert(alignof(Derived) <= alignof(max_align_t), "Over-aligned slots are not supported");
+    constexpr auto offset = SlotHeader::slotOffset();
+    constexpr auto size = offset + sizeof(Derived);
+    auto block = SharedBlock::allocate(resource.get(), size);
+    auto header = new (block) SlotHeader;
+    header->resource = resource.get();
+    header->size = uint32_t(size);
+
+    Derived* slot = nullptr;
+    try
+    {
+        slot = new (static_cast<char*>(block) + offset) Derived(forward<Arguments>(arguments)...);
+    }
+    catch (...)
+    {
+        header->~SlotHeader();
+        SharedBlock::deallocate(resource.get(), block, size);
+        throw;
+    }
+    // The slot finds its header at a fixed offset, so the core slot must be at the start of the derived slot.
+    COMP_ASSERT(static_cast<void*>(static_cast<Slot*>(slot)) == static_cast<void*>(slot));
+    if (resource)
+    {
+        intrusive_ptr_add_ref(resource.get());
+    }
+    // The header is created with the strong reference of the returned pointer.
+    return intrusive_ptr<Slot>(slot, false);
+}
+
+template <typename LockType>
+bool Slot<LockType>::tryRetain()
+{
+    auto& strongCount = getHeader().strongCount;
+    auto count = strongCount.load(memory_order_relaxed);
+    while (count > 0u)
+    {
+        if (strongCount.compare_exchange_weak(count, count + 1u, memory_order_relaxed))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+template <typename LockType>
+void Slot<LockType>::release()
+{
+    auto& header = getHeader();
+    if (header.strongCount.fetch_sub(1u, memory_order_acq_rel) == 1u)
+    {
+        // The slot reads disconnected to the weak references once destroyed.
+        header.state.fetch_and(~size_t(Connected | Polled));
+        this->~Slot();
+        header.releaseWeak();
+    }
+}
+
 template <typename LockType>
 bool Slot<LockType>::isConnected() const
 {
-    if (!m_isConnected.load())
+    // The activation re-checks the connected state, so a relaxed load is enough.
+    const auto state = getState();
+    if ((state & Connected) != Connected)
+    {
+        return false;
+    }
+    if ((state & Polled) == Polled && !areTrackersValid())
     {
         return false;
     }
+    return ((state & Receiver) != Receiver) || isReceiverValid();
+}
 
-    try
+template <typename LockType>
+bool Slot<LockType>::areTrackersValid() const
+{
+    // Register the reader in the counter of the current epoch. The writers wait for the readers registered
+    // before they flip the epoch, the readers registered after the flip find the removed trackers unlinked.
+    auto& readers = getHeader().trackerReaders;
+    auto value = readers.load(memory_order_relaxed);
+    auto unit = uint32_t(0u);
+    do
+    {
+        unit = (value & OddEpoch) ? OddReaderUnit : EvenReaderUnit;
+    }
+    while (!readers.compare_exchange_weak(value, value + unit));
+
+    auto isValid = true;
+    for (auto tracker = m_trackers.load(memory_order_acquire); tracker && isValid; tracker = tracker->next.load(memory_order_acquire))
+    {
+        isValid = tracker->isValid();
+    }
+
+    readers.fetch_sub(unit, memory_order_release);
+    return isValid;
+}
+
+template <typename LockType>
+void Slot<LockType>::waitForTrackerReaders()
+{
+#ifdef COMP_CONFIG_THREAD_ENABLED
+    auto& readers = getHeader().trackerReaders;
+    const auto previous = readers.fetch_xor(OddEpoch);
+    const auto mask = (previous & OddEpoch) ? OddReaderMask : EvenReaderMask;
+    while (readers.load() & mask)
+    {
+        this_thread::yield();
+    }
+#endif
+}
+
+template <typename LockType>
+void Slot<LockType>::disconnect(bool waitForActivations)
+{
     {
-        auto isTrackerValid = [](auto& tracker)
+        lock_guard lock(*this);
+        // Detach the slot before notifying the signal, so the signal finds the slot disconnected.
+        const auto state = getHeader().state.fetch_and(~size_t(Connected | Polled));
+        if ((state & Connected) == Connected)
         {
-            return !tracker->isValid();
-        };
-        auto it = find_if(m_trackers, isTrackerValid);
-        return (it == m_trackers.cend());
+            disconnectOverride();
+            clearTrackers();
+        }
+
+        if (m_signal)
+        {
+            auto signal = m_signal;
+            m_signal = nullptr;
+            relock_guard relock(*this);
+            signal->notifySlotDisconnected(*this);
+        }
+    }
+
+#ifdef COMP_CONFIG_THREAD_ENABLED
+    while (waitForActivations && getHeader().state.load() >= ActivationUnit)
+    {
+        this_thread::yield();
+    }
+#else
+    // Without threads, the in-flight activations are on the calling thread.
+    COMP_UNUSED(waitForActivations);
+#endif
+}
+
+template <typename LockType>
+template <class TrackerType, class... Arguments>
+void Slot<LockType>::addTracker(Arguments&&... arguments)
+{
+    constexpr auto fitsStorage = sizeof(TrackerType) <= inlineTrackerSize && alignof(TrackerType) <= alignof(TrackerInterface);
+
+    lock_guard lock(*this);
+    void* block = nullptr;
+    if (fitsStorage && isTrackerStorageFree())
+    {
+        block = m_trackerStorage;
+    }
+    else
+    {
+        block = SharedBlock::allocate(getHeader().resource, sizeof(TrackerType));
+    }
+
+    TrackerInterface* tracker = nullptr;
+    try
+    {
+        tracker = new (block) TrackerType(forward<Arguments>(arguments)...);
     }
     catch (...)
     {
-        return false;
+        if (block != m_trackerStorage)
+        {
+            SharedBlock::deallocate(getHeader().resource, block, sizeof(TrackerType));
+        }
+        throw;
+    }
+    // The tracker is released through its interface, so the interface must be at the start of the tracker.
+    COMP_ASSERT(static_cast<void*>(tracker) == block);
+
+    // Publish the constructed tracker to the readers.
+    tracker->next.store(m_trackers.load(memory_order_relaxed), memory_order_relaxed);
+    m_trackers.store(tracker, memory_order_release);
+    if (tracker->isPolled())
+    {
+        getHeader().state |= Polled;
     }
 }
 
 template <typename LockType>
-void Slot<LockType>::disconnect()
+void Slot<LockType>::removeTracker(const void* connectionTracker)
 {
     lock_guard lock(*this);
-    if (m_signal)
+    for (auto link = &m_trackers; auto tracker = link->load(memory_order_relaxed);)
     {
-        auto signal = m_signal;
-        m_signal = nullptr;
-        relock_guard relock(*this);
-        signal->disconnect(Connection(this->shared_from_this()));
+        if (tracker->getConnectionTracker() == connectionTracker)
+        {
+            // The readers walking the unlinked tracker continue with its next tracker.
+            link->store(tracker->next.load(memory_order_relaxed), memory_order_release);
+            waitForTrackerReaders();
+            destroyTracker(tracker);
+        }
+        else
+        {
+            link = &tracker->next;
+        }
     }
+}
 
-    auto isConnected = m_isConnected.exchange(false);
-    if (!isConnected)
+template <typename LockType>
+void Slot<LockType>::clearTrackers()
+{
+    auto tracker = m_trackers.exchange(nullptr);
+    if (!tracker)
     {
-        // Already disconnected.
         return;
     }
+    waitForTrackerReaders();
+    while (tracker)
+    {
+        destroyTracker(exchange(tracker, tracker->next.load(memory_order_relaxed)));
+    }
+}
+
+template <typename LockType>
+void Slot<LockType>::destroyTracker(TrackerInterface* tracker)
+{
+    const auto size = tracker->getSize();
+    tracker->~TrackerInterface();
+    if (static_cast<void*>(tracker) != m_trackerStorage)
+    {
+        SharedBlock::deallocate(getHeader().resource, tracker, size);
+    }
+}
+
+template <typename LockType>
+bool Slot<LockType>::isTrackerStorageFree() const
+{
+    for (auto tracker = m_trackers.load(memory_order_relaxed); tracker; tracker = tracker->next.load(memory_order_relaxed))
+    {
+        if (static_cast<const void*>(tracker) == m_trackerStorage)
+        {
+            return false;
+        }
+    }
+    return true;
+}
 
-    disconnectOverride();
-    m_trackers.clear();
+template <typename LockType>
+Signal* Slot<LockType>::getSignal()
+{
+    lock_guard lock(*this);
+    return m_signal;
 }
 
 template <typename LockType>
-void Slot<LockType>::addTracker(TrackerPtr tracker)
+MemoryResourcePtr Slot<LockType>::getMemoryResource()
 {
     lock_guard lock(*this);
-    m_trackers.push_back(tracker);
+    return m_signal ? m_signal->getMemoryResource() : MemoryResourcePtr();
 }
 
 }} // comp::core
@@ -3,54 +3,117 @@
 
 #include <comp/config.hpp>
 #include <comp/concept/core/signal_impl.hpp>
+#include <comp/concept/slot_store.hpp>
+#include <comp/wrap/algorithm.hpp>
 #include <comp/wrap/memory.hpp>
+#include <comp/wrap/functional.hpp>
+#include <comp/wrap/future.hpp>
+#include <comp/wrap/intrusive_ptr.hpp>
 #include <comp/wrap/mutex.hpp>
+#include <comp/wrap/optional.hpp>
+#include <comp/wrap/span.hpp>
+#include <comp/wrap/tuple.hpp>
+#include <comp/wrap/utility.hpp>
 #include <comp/wrap/vector.hpp>
 #include <comp/wrap/type_traits.hpp>
 #include <comp/wrap/function_traits.hpp>
+#include <comp/utility/executor.hpp>
+#include <comp/utility/instrumentation.hpp>
 #include <comp/utility/tracker.hpp>
 
 namespace comp
 {
 
 // Forward declarations.
-using SlotPtr = shared_ptr<core::Slot<mutex>>;
-using SlotWeakPtr = weak_ptr<core::Slot<mutex>>;
+class EventLoop;
+using SlotPtr = intrusive_ptr<core::Slot<mutex>>;
 
 /// The Connection holds a slot connected to a signal. It is a token to a receiver slot connected to
-/// that signal.
+/// that signal. The connection holds a weak reference to the slot.
 class COMP_API Connection
 {
+    friend class ConnectionView;
+
 public:
     /// Constructor.
     Connection() = default;
 
     /// Constructs the connection with a \a slot.
     Connection(SlotPtr slot)
-        : m_slot(slot)
+        : Connection(slot.get())
+    {
+    }
+
+    /// Copy and move constructors.
+    Connection(const Connection& other)
+        : Connection(other.m_slot)
+    {
+    }
+    Connection(Connection&& other)
+        : m_slot(exchange(other.m_slot, nullptr))
     {
     }
 
     /// Destructor.
-    ~Connection() = default;
+    ~Connection()
+    {
+        if (m_slot)
+        {
+            m_slot->releaseWeak();
+        }
+    }
+
+    /// Assignment operator.
+    Connection& operator=(Connection other)
+    {
+        swap(m_slot, other.m_slot);
+        return *this;
+    }
 
     /// Disconnects the slot.
-    void disconnect()
+    /// \param waitForActivations If \e true, waits for the in-flight activations of the slot to complete.
+    /// \see core::Slot::disconnect()
+    void disconnect(bool waitForActivations = false)
     {
-        auto slot = m_slot.lock();
+        auto slot = get();
         if (!slot)
         {
             return;
         }
-        slot->disconnect();
+        slot->disconnect(waitForActivations);
+    }
+
+    /// Compares two connections. Two connections are equal if they hold the same slot.
+    bool operator==(const Connection& other) const
+    {
+        return m_slot == other.m_slot;
+    }
+    bool operator!=(const Connection& other) const
+    {
+        return !(*this == other);
     }
 
-    /// Returns the valid state of the connection.
+    /// Returns the valid state of the connection. Unless the slot has trackers that are polled, the check is
+    /// a single atomic load.
     /// \return If the connection is valid, returns \e true, otherwise returns \e false. A connection is invalid when its
     /// source signal or its trackers are destroyed.
     operator bool() const
     {
-        const auto slot = m_slot.lock();
+        if (!m_slot)
+        {
+            return false;
+        }
+        const auto state = m_slot->getState();
+        if ((state & core::Slot<mutex>::Connected) != core::Slot<mutex>::Connected)
+        {
+            return false;
+        }
+        if ((state & (core::Slot<mutex>::Polled | core::Slot<mutex>::Receiver)) == 0u)
+        {
+            return true;
+        }
+        // Polling the trackers and the receiver touches the slot, keep the slot alive.
+        const auto slot = get();
         return slot && slot->isConnected();
     }
 
@@ -76,14 +139,24 @@ public:
     Connection& bind(Trackers... trackers);
 
     /// Returns the slot of the connection.
-    /// \return The slot of the connection. If the connection is not valid, returns \e nullptr.
+    /// \return The slot of the connection. If the slot is destroyed, returns \e nullptr.
     SlotPtr get() const
     {
-        return m_slot.lock();
+        return (m_slot && m_slot->tryRetain()) ? SlotPtr(m_slot, false) : SlotPtr();
     }
 
 private:
-    SlotWeakPtr m_slot;
+    /// Constructs the connection with a weak reference to a \a slot.
+    explicit Connection(core::Slot<mutex>* slot)
+        : m_slot(slot)
+    {
+        if (m_slot)
+        {
+            m_slot->retainWeak();
+        }
+    }
+
+    core::Slot<mutex>* m_slot = nullptr;
 
     /// Binds a \a tracker object to a \a slot. The tracker object is either a shared pointer, a weak pointer,
     /// a ConnectionTracker object, or a shared pointer to a ConnectionTracker.
@@ -91,12 +164,198 @@ private:
     void bindOne(SlotPtr slot, TrackerType tracker);
 };
 
+/// The ConnectionView is a non-owning reference to a slot, passed to the collectors and to the slots during
+/// their activation. Creating a view takes no reference count. The view is only valid while the slot is
+/// activated or its result is collected; to keep the connection, convert the view to a Connection.
+class COMP_API ConnectionView
+{
+public:
+    /// Constructor.
+    ConnectionView() = default;
+
+    /// Constructs the view of a \a slot.
+    ConnectionView(core::Slot<mutex>& slot)
+        : m_slot(&slot)
+    {
+    }
+
+    /// Creates the connection of the viewed slot.
+    /// \return The connection of the slot. If the view is empty, returns an invalid connection.
+    operator Connection() const
+    {
+        return Connection(m_slot);
+    }
+
+    /// Disconnects the slot.
+    /// \param waitForActivations If \e true, waits for the in-flight activations of the slot to complete.
+    /// \see core::Slot::disconnect()
+    void disconnect(bool waitForActivations = false)
+    {
+        if (m_slot)
+        {
+            m_slot->disconnect(waitForActivations);
+        }
+    }
+
+    /// Compares two views. Two views are equal if they refer to the same slot.
+    bool operator==(const ConnectionView& other) const
+    {
+        return m_slot == other.m_slot;
+    }
+    bool operator!=(const ConnectionView& other) const
+    {
+        return !(*this == other);
+    }
+
+    /// Returns the valid state of the viewed connection.
+    /// \return If the view refers to a connected slot, returns \e true, otherwise returns \e false.
+    operator bool() const
+    {
+        return m_slot && m_slot->isConnected();
+    }
+
+    /// Returns the viewed slot.
+    /// \return The viewed slot. If the view is empty, returns \e nullptr.
+    core::Slot<mutex>* get() const
+    {
+        return m_slot;
+    }
+
+private:
+    core::Slot<mutex>* m_slot = nullptr;
+};
+
+/// The link of a connection in the list of a ConnectionTracker. The links are embedded in the trackers bound
+/// to the slots, so tracking a connection takes no allocation. The link unlinks itself on destruction.
+class COMP_API TrackerLink
+{
+    friend class Tracker<Connection>;
+
+    Tracker<Connection>* m_owner = nullptr;
+    TrackerLink* m_previous = nullptr;
+    TrackerLink* m_next = nullptr;
+
+    COMP_DISABLE_COPY_OR_MOVE(TrackerLink)
+
+public:
+    /// Constructs the link of a \a connection.
+    explicit TrackerLink(Connection connection)
+        : connection(move(connection))
+    {
+    }
+
+    /// Destructor, unlinks the link.
+    ~TrackerLink()
+    {
+        unlink();
+    }
+
+    /// Links the connection to the front of the list of an \a owner tracker.
+    /// \param owner The tracker to link to.
+    void link(Tracker<Connection>& owner);
+
+    /// Unlinks the connection from the list of its tracker. Does nothing if the link is not linked.
+    void unlink();
+
+    /// Returns the tracker the link is linked to.
+    /// \return The tracker of the link. If the link is not linked, returns \e nullptr.
+    const Tracker<Connection>* getOwner() const
+    {
+        return m_owner;
+    }
+
+    /// The linked connection.
+    const Connection connection;
+};
+
 /// To track the lifetime of a connection based on an arbitrary object that is not a smart pointer,
 /// use this class. The class disconnects all tracked slots on destruction.
 /// You can bind trackers to a connection using the #Connection::bind() method, by passing the pointer
 /// to the ConnectionTracker object as argument of the method.
+///
+/// The tracked connections are held in an intrusive list of the links embedded in the trackers of the slots.
+/// Tracking and untracking a connection takes constant time, and clearing the tracked connections takes no
+/// allocation.
+template <>
+class COMP_API Tracker<Connection>
+{
+    friend class TrackerLink;
+
+    COMP_DISABLE_COPY_OR_MOVE(Tracker)
+
+public:
+    /// Constructor.
+    explicit Tracker() = default;
+
+    /// Destructor, disconnects the tracked connections.
+    ~Tracker()
+    {
+        clearTrackables();
+    }
+
+    /// Tracks a \a connection. Same as binding the tracker to the connection.
+    /// \param connection The connection to track. Disconnected connections are not tracked.
+    void track(Connection connection);
+
+    /// Removes a tracked \a connection. Does not disconnect the tracked connection.
+    /// \param connection The connection to untrack.
+    void untrack(Connection connection);
+
+    /// Clears the tracked connections, disconnecting each tracked connection.
+    void clearTrackables()
+    {
+        while (m_first)
+        {
+            // Disconnecting the slot destroys the link, take the connection first.
+            auto connection = m_first->connection;
+            m_first->unlink();
+            connection.disconnect();
+        }
+    }
+
+private:
+    TrackerLink* m_first = nullptr;
+};
+
 using ConnectionTracker = Tracker<Connection>;
 
+inline void TrackerLink::link(Tracker<Connection>& owner)
+{
+    COMP_ASSERT(!m_owner);
+    m_owner = &owner;
+    m_next = exchange(owner.m_first, this);
+    if (m_next)
+    {
+        m_next->m_previous = this;
+    }
+}
+
+inline void TrackerLink::unlink()
+{
+    if (!m_owner)
+    {
+        return;
+    }
+    (m_previous ? m_previous->m_next : m_owner->m_first) = m_next;
+    if (m_next)
+    {
+        m_next->m_previous = m_previous;
+    }
+    m_owner = nullptr;
+    m_previous = nullptr;
+    m_next = nullptr;
+}
+
+/// The type in which the signal passes an argument of its signature to the slots. Arguments declared by value
+/// are bound once as const references, so the slots of the signal share the same argument without copies. Slots
+/// declaring the argument by value copy the argument. Reference arguments are passed as declared.
+template <typename T>
+using signal_argument_t = conditional_t<is_reference_v<T>, T, const T&>;
+
+/// The batch of events passed to a batch emission. Each event holds the arguments of one emission.
+template <typename... Arguments>
+using signal_batch_t = span<const tuple<Arguments...>>;
+
 /********************************************************************************
  * Collectors
  */
@@ -105,8 +364,9 @@ using ConnectionTracker = Tracker<Connection>;
 ///
 /// You can create collectors deriving from this template class, and implement a \e handleResult function
 /// with the following signature:
-/// - \e {bool handleResult(Connection[, ReturnType [const&]])}
-/// where \e Connection is the connection to the slot, and \e ReturnType is the return type of the slot.
+/// - \e {bool handleResult(ConnectionView[, ReturnType [const&]])}
+/// where \e ConnectionView is the view of the connection to the slot, and \e ReturnType is the return type of
+/// the slot. Collectors that take a Connection instead of the view create the connection of each collected slot.
 /// You must specify the return type if the slot returns a non-void value. To stop the signal activation,
 /// return \e false, otherwise return \e true.
 template <class DerivedCollector>
@@ -122,7 +382,8 @@ public:
     explicit Collector() = default;
 
     /// Activates the slot and collects the return value of the slot. Your collector must implement
-    /// a \e handleResult function to collect the results of the activated slot.
+    /// a \e handleResult function to collect the results of the activated slot. Slots that are not activated,
+    /// because they are disconnected or their receiver is destroyed, are skipped.
     /// \tparam SlotType
     /// \tparam ReturnType
     /// \tparam Arguments
@@ -132,6 +393,28 @@ public:
     /// \e false, the signal activation breaks.
     template <class SlotType, typename ReturnType, typename... Arguments>
     bool collect(SlotType& slot, Arguments&&... arguments);
+
+    /// Collects the activation \a result of the slot of a \a connection. Emissions that activate the slots
+    /// separately from collecting, such as the asynchronous and batch emissions, use this method. Results
+    /// of slots that were not activated are skipped.
+    /// \tparam ReturnType The return type of the signal.
+    /// \param connection The connection of the activated slot.
+    /// \param result The activation result of the slot.
+    /// \return If the collector succeeds, returns \e true, otherwise \e false. If the collector returns
+    /// \e false, the collecting breaks.
+    template <typename ReturnType, typename ResultType>
+    bool collectResult(ConnectionView connection, ResultType& result);
+
+    /// Invokes a \a function with \a arguments, and collects the return value of the function. Signals with
+    /// slots that are not connected use this method to activate the slots, passing an empty connection view to
+    /// the \e handleResult function of your collector.
+    /// \tparam ReturnType The return type of the signal.
+    /// \param function The function to invoke.
+    /// \param arguments The arguments to pass to the function.
+    /// \return If the collector succeeds, returns \e true, otherwise \e false. If the collector returns
+    /// \e false, the signal activation breaks.
+    template <typename ReturnType, class FunctionType, typename... Arguments>
+    bool collectCall(FunctionType&& function, Arguments&&... arguments);
 };
 
 /// The default signal collector specialized for signals with void return type.
@@ -145,7 +428,7 @@ struct DefaultSignalCollector : public Collector<DefaultSignalCollector<T>>
     }
 
     /// Handles the result. Slots with void return type only have the connection as argument.
-    bool handleResult(Connection)
+    bool handleResult(ConnectionView)
     {
         ++callCount;
         return true;
@@ -161,7 +444,7 @@ struct DefaultSignalCollector<T, enable_if_t<!is_void_v<T>, void>> : public Coll
                                                                      public vector<T>
 {
     /// Handles the result.
-    bool handleResult(Connection, T result)
+    bool handleResult(ConnectionView, T result)
     {
         vector<T>::push_back(result);
         return true;
@@ -172,27 +455,105 @@ struct DefaultSignalCollector<T, enable_if_t<!is_void_v<T>, void>> : public Coll
  * Concepts
  */
 
+template <typename ReturnType, typename... Arguments>
+class SignalConcept;
+
 /// The Slot holds the invocable connected to a signal. The slot is a function, a function object, a method
 /// or an other signal.
 template <typename ReturnType, typename... Arguments>
 class COMP_TEMPLATE_API SlotConcept : public core::Slot<mutex>
 {
+    friend class SignalConcept<ReturnType, Arguments...>;
     using Base = core::Slot<mutex>;
+    using ResultType = conditional_t<is_reference_v<ReturnType>, reference_wrapper<remove_reference_t<ReturnType>>, ReturnType>;
+
 public:
-    /// Activates the slot with the arguments passed, and returns the slot's return value.
-    ReturnType activate(Arguments&&...);
+    /// The result of a slot activation. For slots with void return type, the result is \e true if the slot was
+    /// activated. For slots with non-void return type, the result holds the return value of the slot if the slot
+    /// was activated. A slot is not activated if it is disconnected, or if its receiver is destroyed.
+    using ActivationResult = conditional_t<is_void_v<ReturnType>, bool, optional<ResultType>>;
+
+    /// Activates the slot with the arguments passed, and returns the slot's return value. If the receiver of
+    /// the slot is destroyed, disconnects the slot.
+    /// \return The activation result.
+    ActivationResult activate(signal_argument_t<Arguments>...);
+
+    /// Activates the slot with each event of a batch. The slot is marked activated once for the whole batch.
+    /// Batch slots receive the batch in a single call. If the receiver of the slot is destroyed, disconnects
+    /// the slot.
+    /// \param events The events of the batch.
+    /// \param handleResult The function called with the activation result of each event. Return \e false
+    /// from the function to stop the activation.
+    /// \return If \a handleResult stops the activation, returns \e false, otherwise \e true.
+    template <class ResultHandler>
+    bool activateBatch(signal_batch_t<Arguments...> events, ResultHandler&& handleResult);
+
+    /// Disconnects the slot because its receiver or one of its trackers is destroyed.
+    void autoDisconnect();
+
+    /// Returns the priority of the slot. The slots with higher priority are activated first.
+    int getPriority() const
+    {
+        return m_priority;
+    }
+
+#ifdef COMP_CONFIG_INSTRUMENTATION_ENABLED
+    /// Returns the activation time histogram of the slot.
+    const LatencyHistogram& getActivationTimes() const
+    {
+        return m_activationTimes;
+    }
+#endif
 
 protected:
     /// Constructor.
     explicit SlotConcept(core::Signal& signal)
         : Base(signal)
+#ifdef COMP_CONFIG_INSTRUMENTATION_ENABLED
+        , m_statistics(signal.getStatistics())
+#endif
+    {
+    }
+
+    /// To implement slot specific activation, override this method. Return an empty result when the receiver of
+    /// the slot is destroyed.
+    virtual ActivationResult activateOverride(signal_argument_t<Arguments>...) = 0;
+
+    /// Batch slots override this method to receive the events of a batch in a single call. Return \e false if
+    /// the slot is to be activated with each event of the batch.
+    virtual bool activateBatchOverride(signal_batch_t<Arguments...>)
     {
+        return false;
     }
 
-    /// To implement slot specific activation, override this method.
-    virtual ReturnType activateOverride(Arguments&&...) = 0;
+private:
+#ifdef COMP_CONFIG_INSTRUMENTATION_ENABLED
+    /// Records the activation of the slot with \a count events, started at \a start.
+    void recordActivation(chrono::steady_clock::time_point start, size_t count = 1u);
+#endif
+
+    int m_priority = 0;
+#ifdef COMP_CONFIG_INSTRUMENTATION_ENABLED
+    /// The statistics of the signal, shared with the slot, so activations that outlive the signal are counted.
+    SignalStatisticsPtr m_statistics;
+    LatencyHistogram m_activationTimes;
+#endif
 };
 
+/// Adds a strong reference to a \a slot held by an intrusive_ptr<>.
+template <typename ReturnType, typename... Arguments>
+void intrusive_ptr_add_ref(SlotConcept<ReturnType, Arguments...>* slot)
+{
+    slot->retain();
+}
+
+/// Releases a strong reference to a \a slot held by an intrusive_ptr<>.
+template <typename ReturnType, typename... Arguments>
+void intrusive_ptr_release(SlotConcept<ReturnType, Arguments...>* slot)
+{
+    slot->release();
+}
+
 /// The SignalConcept defines the concept of a signal. Defined as a lockable for convenience, holds the
 /// connections of the signal.
 template <typename ReturnType, typename... Arguments>
@@ -200,8 +561,9 @@ class COMP_TEMPLATE_API SignalConcept : public Lockable<mutex>, public core::Sig
 {
 public:
     using SlotType = SlotConcept<ReturnType, Arguments...>;
-    using SlotTypePtr = shared_ptr<SlotType>;
+    using SlotTypePtr = intrusive_ptr<SlotType>;
     using SignalConceptType = SignalConcept<ReturnType, Arguments...>;
+    using SlotStoreType = SlotStore<SlotType>;
 
     /// Destructor.
     ~SignalConcept();
@@ -221,16 +583,55 @@ public:
     }
 
     /// Activates the signal with a specific \a Collector. Returns the collected results gathered from the
-    /// activated slots by the collector type.
+    /// activated slots by the collector type. The signal can be emitted concurrently from multiple threads.
+    /// A signal emitted from a slot activated by the same signal on the same thread is not activated.
+    /// \tparam Collector The collector used in emit.
+    /// \param arguments The arguments to pass. The slots share the arguments, see signal_argument_t.
+    template <class Collector = DefaultSignalCollector<ReturnType>>
+    Collector operator()(signal_argument_t<Arguments>... arguments);
+
+    /// Activates the signal, and collects the results of the slots into a caller-owned \a collector. Reuse
+    /// the collector to reuse its storage across emissions; the collector is not reset by the emission.
+    /// \param collector The collector of the results.
+    /// \param arguments The arguments to pass. The slots share the arguments, see signal_argument_t.
+    /// \return The collector.
+    template <class Collector>
+    Collector& emit(Collector& collector, signal_argument_t<Arguments>... arguments);
+
+    /// Activates the signal with a batch of \a events. The emission takes one snapshot of the slots, and
+    /// activates each slot with all the events before moving to the next slot. The trackers of a slot are
+    /// checked once per batch. The results are collected in the same order, grouped by slot. Slots connected
+    /// with connectBatch() receive the whole batch in one call.
+    /// \tparam Collector The collector used in emit.
+    /// \param events The events to emit, each holding the arguments of one emission.
+    template <class Collector = DefaultSignalCollector<ReturnType>>
+    Collector emitBatch(signal_batch_t<Arguments...> events);
+
+#ifdef COMP_CONFIG_THREAD_ENABLED
+    /// Activates the signal asynchronously on an \a executor. Each connected slot is activated in a separate
+    /// task, so the slots run in parallel if the executor has multiple threads. Once all the slots are
+    /// activated, the results are collected with the \a Collector in the connection order of the slots, on
+    /// the thread that completes the last activation. When the collector breaks, only the collecting stops;
+    /// the slots are activated regardless.
+    ///
+    /// The arguments declared by value are copied once, and shared by the slots. Arguments declared by
+    /// reference must outlive the returned future.
     /// \tparam Collector The collector used in emit.
+    /// \param executor The executor that runs the slot activations.
     /// \param arguments The arguments to pass.
+    /// \return The future of the collector. If a slot throws an exception, the future holds the exception
+    /// of the first throwing slot in connection order. If the signal is blocked, or gets emitted from one of
+    /// its slots, returns a ready future with an empty collector.
     template <class Collector = DefaultSignalCollector<ReturnType>>
-    Collector operator()(Arguments... arguments);
+    future<Collector> emitAsync(Executor& executor, signal_argument_t<Arguments>... arguments);
+#endif
 
-    /// Adds a \a slot to the signal.
+    /// Adds a \a slot to the signal with a \a priority. The slots with higher priority are activated first,
+    /// the slots with the same priority are activated in connection order.
     /// \param slot The slot to add to the signal.
+    /// \param priority The priority of the slot.
     /// \return The connection token with the signal and the slot.
-    Connection addSlot(SlotPtr slot);
+    Connection addSlot(SlotPtr slot, int priority = 0);
 
     /// Connects a \a method of a \a receiver to this signal.
     /// \param receiver The receiver of the connection.
@@ -247,28 +648,201 @@ public:
     enable_if_t<!is_base_of_v<SignalConceptType, FunctionType>, Connection>
     connect(const FunctionType& function);
 
+    /// Connects a \a method of a \a receiver to this signal with a \a priority. The slots with higher priority
+    /// are activated first, the slots with the same priority are activated in connection order. The slots
+    /// connected without priority have priority 0. Use the priority values to order groups of slots.
+    /// \param priority The priority of the slot.
+    /// \param receiver The receiver of the connection.
+    /// \param method The method to connect.
+    /// \return Returns the shared pointer to the connection.
+    template <class FunctionType>
+    enable_if_t<is_member_function_pointer_v<FunctionType>, Connection>
+    connect(int priority, shared_ptr<typename function_traits<FunctionType>::object> receiver, FunctionType method);
+
+    /// Connects a \a function, or a lambda to this signal with a \a priority.
+    /// \param priority The priority of the slot.
+    /// \param slot The function, functor or lambda to connect.
+    /// \return Returns the shared pointer to the connection.
+    /// \see connect(int, shared_ptr<>, FunctionType)
+    template <class FunctionType>
+    enable_if_t<!is_base_of_v<SignalConceptType, FunctionType>, Connection>
+    connect(int priority, const FunctionType& function);
+
+    /// Connects a \a function, or a lambda to this signal with a queued connection. When the signal is emitted,
+    /// the arguments are copied once into an event posted to the event \a loop, and the function is invoked
+    /// when the loop delivers the event, on the thread of the loop. The slot is counted as activated when the
+    /// event is posted. The trackers of the slot are checked again when the event is delivered; if the slot
+    /// gets disconnected in the meantime, the event is dropped. When the loop is destroyed, the slot gets
+    /// disconnected on the next emission.
+    ///
+    /// Queued connections are only available on signals with void return type.
+    /// \param loop The event loop on which the function is invoked.
+    /// \param function The function, functor or lambda to connect.
+    /// \return Returns the shared pointer to the connection.
+    template <class FunctionType>
+    enable_if_t<!is_member_function_pointer_v<FunctionType>, Connection>
+    connect(EventLoop& loop, const FunctionType& function);
+
+    /// Connects a \a method of a \a receiver to this signal with a queued connection. The method is invoked
+    /// on the thread of the event \a loop, if the receiver is alive by the time the event is delivered.
+    /// \param loop The event loop on which the method is invoked.
+    /// \param receiver The receiver of the connection.
+    /// \param method The method to connect.
+    /// \return Returns the shared pointer to the connection.
+    /// \see connect(EventLoop&, const FunctionType&)
+    template <class FunctionType>
+    enable_if_t<is_member_function_pointer_v<FunctionType>, Connection>
+    connect(EventLoop& loop, shared_ptr<typename function_traits<FunctionType>::object> receiver, FunctionType method);
+
+    /// Connects a batch \a function to this signal. The function receives the events of a batch emission in
+    /// one call, as signal_batch_t. A regular emission passes a batch of one event to the function, holding
+    /// a copy of the arguments. Batch connections are only available on signals with void return type.
+    /// \param function The function, functor or lambda to connect.
+    /// \return Returns the shared pointer to the connection.
+    /// \see emitBatch()
+    template <class FunctionType>
+    Connection connectBatch(const FunctionType& function);
+
     /// Creates a connection between this signal and a \a receiver signal.
     /// \param receiver The receiver signal connected to this signal.
     /// \return Returns the shared pointer to the connection.
     Connection connect(SignalConcept& receiver);
 
-    /// Disconnects the \a connection passed as argument.
+    /// Creates a connection between this signal and a \a receiver signal with a \a priority.
+    /// \param priority The priority of the slot.
+    /// \param receiver The receiver signal connected to this signal.
+    /// \return Returns the shared pointer to the connection.
+    /// \see connect(int, shared_ptr<>, FunctionType)
+    Connection connect(int priority, SignalConcept& receiver);
+
+    /// Disconnects the \a connection passed as argument. The disconnect takes constant time: the slot of the
+    /// connection is marked disconnected, and removed from the signal once the disconnected slots take half of the
+    /// slot container.
     /// \param connection The connection to disconnect. The connection is invalidated and removed from the signal.
     void disconnect(Connection connection) override;
 
+#ifdef COMP_CONFIG_COROUTINES_ENABLED
+    /// The node of a waiter parked on the signal. The waiters are resumed once, by the next emission of the
+    /// signal, after the slots are activated. The node is owned by the waiter, the signal takes no allocation
+    /// to park a waiter.
+    /// \see SignalAwaiter
+    struct Waiter
+    {
+        /// The function that resumes the waiter with the arguments of the emission.
+        using ResumeFunction = void(*)(Waiter&, signal_argument_t<Arguments>...);
+
+        explicit Waiter(ResumeFunction resume)
+            : resume(resume)
+        {
+        }
+
+        /// The signal on which the waiter is parked, \e nullptr if the waiter is not parked.
+        SignalConcept* signal = nullptr;
+        Waiter* next = nullptr;
+        ResumeFunction resume = nullptr;
+    };
+
+    /// Parks a \a waiter on the signal, to get resumed by the next emission.
+    /// \param waiter The waiter to park.
+    void addWaiter(Waiter& waiter);
+
+    /// Removes a \a waiter parked on the signal. Does nothing if the waiter is not parked.
+    /// \param waiter The waiter to remove.
+    void removeWaiter(Waiter& waiter);
+#endif
+
+#ifdef COMP_CONFIG_INSTRUMENTATION_ENABLED
+    /// Sets the \a name of the signal, reported in the snapshots of the StatisticsRegistry.
+    /// \param name The name of the signal.
+    void setStatisticsName(const string& name)
+    {
+        m_registryEntry.setName(name);
+    }
+#endif
+
 protected:
     /// Constructor.
     explicit SignalConcept() = default;
 
-    /// The container of the connections.
-    FlagGuard m_emitGuard;
+    /// Constructs the signal with \a shardCount slot stores. Each slot is held by one of the shards, picked
+    /// by the address of the slot, so connecting and disconnecting slots of different shards does not contend
+    /// on the same lock. The emission walks the shards in order.
+    /// \param shardCount The number of shards, at least one.
+    explicit SignalConcept(size_t shardCount);
 
-    /// The container with the connected slots.
-    using SlotContainer = vector<SlotTypePtr>;
-    SlotContainer m_slots;
+    /// The container type of the slot snapshots.
+    using SlotContainer = typename SlotStoreType::Container;
+
+    /// Returns the number of shards of the signal.
+    size_t getShardCount() const
+    {
+        return m_shardCount;
+    }
+
+    /// Returns the shard at \a index.
+    SlotStoreType& getShard(size_t index)
+    {
+        return (index == 0u) ? m_store : m_shards[index - 1u];
+    }
+
+    /// Returns the shard that holds a \a slot.
+    SlotStoreType& getShard(const core::Slot<mutex>& slot);
+
+    /// Returns the snapshot of the connected slots of all the shards, in shard order. Emitters walk the snapshot
+    /// without holding a lock. The snapshot may hold disconnected slots, which the emitters skip.
+    /// \return The snapshot of the connected slots. Returns \e nullptr if the signal has no slots.
+    shared_ptr<const SlotContainer> getSlots();
+
+    /// Calls a \a function with the slots of the signal that are connected, walking the snapshots of the
+    /// shards in order. The slots with invalid trackers are disconnected and skipped.
+    /// \param guard The guard of the emission. The walk stops if a slot destroys the signal.
+    /// \param function The function called with the slot. Return \e false from the function to stop the walk.
+    template <class Function>
+    void forEachSlot(const EmitGuard& guard, Function&& function);
+
+    /// Notifies the shard of the disconnected \a slot.
+    void notifySlotDisconnected(core::Slot<mutex>& slot) override;
 
 private:
+#ifdef COMP_CONFIG_THREAD_ENABLED
+    template <class Collector>
+    struct AsyncEmission;
+#endif
+
+    /// Starts an emission of \a eventCount events. The emission is dropped if the signal is blocked, or if
+    /// the signal is emitted from one of its slots on the calling thread.
+    /// \return If the emission is dropped, returns \e false, otherwise \e true.
+    bool beginEmit(size_t eventCount = 1u);
+
+#ifdef COMP_CONFIG_INSTRUMENTATION_ENABLED
+    /// Collects the activation time histograms of the slots of a \a signal.
+    static void collectSlotStatistics(core::Signal& signal, vector<LatencyHistogram::Buckets>& slots);
+#endif
+
+#ifdef COMP_CONFIG_COROUTINES_ENABLED
+    /// Resumes the parked waiters with the \a arguments of the emission. Stops when a resumed waiter destroys
+    /// the signal of the emission \a guard.
+    void resumeWaiters(const EmitGuard& guard, signal_argument_t<Arguments>... arguments);
+
+    /// The waiters parked on the signal, the last parked first. Modified with the signal locked, the emission
+    /// reads the list without locking when no waiter is parked.
+    atomic<Waiter*> m_waiters = nullptr;
+    /// The waiters taken by an emission to resume, the first parked first. The waiters stay parked until
+    /// resumed, so a waiter destroyed by the resume of an other waiter leaves the signal.
+    Waiter* m_resumedWaiters = nullptr;
+#endif
+
+    /// The first shard, and the additional shards of a sharded signal.
+    SlotStoreType m_store;
+    unique_ptr<SlotStoreType[]> m_shards;
+    size_t m_shardCount = 1u;
+
     atomic_bool m_isBlocked = false;
+#ifdef COMP_CONFIG_INSTRUMENTATION_ENABLED
+    /// Registers the signal to the statistics snapshots, which read the shards from any thread. Keep the entry
+    /// the last member, so the signal is registered once all its members are initialized.
+    StatisticsRegistry::Entry m_registryEntry{*this, this->getStatistics(), &SignalConcept::collectSlotStatistics};
+#endif
 };
 
 } // namespace comp
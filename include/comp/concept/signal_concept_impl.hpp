@@ -3,9 +3,13 @@
 
 #include <comp/concept/signal.hpp>
 #include <comp/concept/slot_concept_impl.hpp>
-#include <comp/wrap/memory.hpp>
+#include <comp/utility/event_loop.hpp>
+#include <comp/wrap/algorithm.hpp>
+#include <comp/wrap/atomic.hpp>
 #include <comp/wrap/exception.hpp>
+#include <comp/wrap/memory.hpp>
 #include <comp/wrap/functional.hpp>
+#include <comp/wrap/tuple.hpp>
 #include <comp/wrap/utility.hpp>
 #include <comp/wrap/vector.hpp>
 
@@ -15,28 +19,71 @@ namespace comp
 namespace
 {
 
+/// Whether a slot argument receives the connection of the slot.
+template <typename T>
+constexpr bool is_connection_argument_v = is_same_v<decay_t<T>, Connection> || is_same_v<decay_t<T>, ConnectionView>;
+
+/// Whether a slot parameter of type \a SlotArgument receives a signal argument of type \a SignalArgument. The
+/// slot takes the argument as declared, or as signal_argument_t, which passes a by-value argument as a const
+/// reference.
+template <typename SlotArgument, typename SignalArgument>
+constexpr bool is_slot_argument_v = is_same_v<SlotArgument, SignalArgument> || is_same_v<SlotArgument, signal_argument_t<SignalArgument>>;
+
+template <typename SlotArguments, typename SignalArguments, typename = void>
+struct are_slot_arguments : false_type
+{
+};
+template <typename... SlotArguments, typename... SignalArguments>
+struct are_slot_arguments<tuple<SlotArguments...>, tuple<SignalArguments...>, enable_if_t<sizeof...(SlotArguments) == sizeof...(SignalArguments)>>
+    : bool_constant<(is_slot_argument_v<SlotArguments, SignalArguments> && ...)>
+{
+};
+
+/// Whether the arguments of a slot \a FunctionType receive the \a Arguments of a signal, see is_slot_argument_v.
+template <typename FunctionType, typename... Arguments>
+constexpr bool is_slot_signature_v = are_slot_arguments<typename function_traits<FunctionType>::arguments, tuple<Arguments...>>::value;
+
+/// Invokes a slot \a function with \a arguments, and returns the activation result of the slot.
+template <typename ActivationResult, typename FunctionType, typename... Arguments>
+ActivationResult invokeSlot(FunctionType&& function, Arguments&&... arguments)
+{
+    if constexpr (is_same_v<ActivationResult, bool>)
+    {
+        invoke(forward<FunctionType>(function), forward<Arguments>(arguments)...);
+        return true;
+    }
+    else
+    {
+        return ActivationResult(invoke(forward<FunctionType>(function), forward<Arguments>(arguments)...));
+    }
+}
+
 template <typename FunctionType, typename ReturnType, typename... Arguments>
 class COMP_TEMPLATE_API FunctionSlot final : public SlotConcept<ReturnType, Arguments...>
 {
-    ReturnType activateOverride(Arguments&&... args) override
+    using Base = SlotConcept<ReturnType, Arguments...>;
+    using ActivationResult = typename Base::ActivationResult;
+
+    ActivationResult activateOverride(signal_argument_t<Arguments>... args) override
     {
         if constexpr (function_traits<FunctionType>::arity == 0u)
         {
-            return invoke(m_function, forward<Arguments>(args)...);
+            return invokeSlot<ActivationResult>(m_function, forward<signal_argument_t<Arguments>>(args)...);
         }
-        else if constexpr (is_same_v<Connection, typename function_traits<FunctionType>::template argument<0u>::type>)
+        else if constexpr (is_connection_argument_v<typename function_traits<FunctionType>::template argument<0u>::type>)
         {
-            return invoke(m_function, Connection(this->shared_from_this()), forward<Arguments>(args)...);
+            // Slots taking a Connection convert the view.
+            return invokeSlot<ActivationResult>(m_function, ConnectionView(*this), forward<signal_argument_t<Arguments>>(args)...);
         }
         else
         {
-            return invoke(m_function, forward<Arguments>(args)...);
+            return invokeSlot<ActivationResult>(m_function, forward<signal_argument_t<Arguments>>(args)...);
         }
     }
 
 public:
     explicit FunctionSlot(core::Signal& signal, const FunctionType& function)
-        : SlotConcept<ReturnType, Arguments...>(signal)
+        : Base(signal)
         , m_function(function)
     {
     }
@@ -48,34 +95,45 @@ private:
 template <class TargetObject, typename FunctionType, typename ReturnType, typename... Arguments>
 class COMP_TEMPLATE_API MethodSlot final : public SlotConcept<ReturnType, Arguments...>
 {
-    ReturnType activateOverride(Arguments&&... arguments) override
+    using Base = SlotConcept<ReturnType, Arguments...>;
+    using ActivationResult = typename Base::ActivationResult;
+
+    ActivationResult activateOverride(signal_argument_t<Arguments>... arguments) override
     {
         auto slotHost = m_target.lock();
         if (!slotHost)
         {
-            throw bad_slot();
+            return {};
         }
 
         if constexpr (function_traits<FunctionType>::arity == 0u)
         {
-            return invoke(m_function, slotHost, forward<Arguments>(arguments)...);
+            return invokeSlot<ActivationResult>(m_function, slotHost, forward<signal_argument_t<Arguments>>(arguments)...);
         }
-        else if constexpr (is_same_v<Connection, typename function_traits<FunctionType>::template argument<0u>::type>)
+        else if constexpr (is_connection_argument_v<typename function_traits<FunctionType>::template argument<0u>::type>)
         {
-            return invoke(m_function, slotHost, Connection(this->shared_from_this()), forward<Arguments>(arguments)...);
+            return invokeSlot<ActivationResult>(m_function, slotHost, ConnectionView(*this), forward<signal_argument_t<Arguments>>(arguments)...);
         }
         else
         {
-            return invoke(m_function, slotHost, forward<Arguments>(arguments)...);
+            return invokeSlot<ActivationResult>(m_function, slotHost, forward<signal_argument_t<Arguments>>(arguments)...);
         }
     }
 
 public:
     explicit MethodSlot(core::Signal& signal, shared_ptr<TargetObject> target, const FunctionType& function)
-        : SlotConcept<ReturnType, Arguments...>(signal)
+        : Base(signal)
         , m_target(target)
         , m_function(function)
     {
+        // The slot checks the receiver itself, instead of binding a polled tracker on it.
+        this->setStateFlags(core::Slot<mutex>::Receiver);
+    }
+
+protected:
+    bool isReceiverValid() const override
+    {
+        return !m_target.expired();
     }
 
 private:
@@ -86,21 +144,25 @@ private:
 template <typename ReceiverSignal, typename ReturnType, typename... Arguments>
 class COMP_TEMPLATE_API SignalSlot final : public SlotConcept<ReturnType, Arguments...>
 {
-    ReturnType activateOverride(Arguments&&... arguments) override
+    using Base = SlotConcept<ReturnType, Arguments...>;
+    using ActivationResult = typename Base::ActivationResult;
+
+    ActivationResult activateOverride(signal_argument_t<Arguments>... arguments) override
     {
         if constexpr (is_void_v<ReturnType>)
         {
-            invoke(*m_receiver, forward<Arguments>(arguments)...);
+            invoke(*m_receiver, forward<signal_argument_t<Arguments>>(arguments)...);
+            return true;
         }
         else
         {
-            return invoke(*m_receiver, forward<Arguments>(arguments)...);
+            return invoke(*m_receiver, forward<signal_argument_t<Arguments>>(arguments)...);
         }
     }
 
 public:
     explicit SignalSlot(core::Signal& signal, ReceiverSignal& receiver)
-        : SlotConcept<ReturnType, Arguments...>(signal)
+        : Base(signal)
         , m_receiver(&receiver)
     {
     }
@@ -109,162 +171,766 @@ private:
     ReceiverSignal* m_receiver = nullptr;
 };
 
+template <typename FunctionType, typename... Arguments>
+class COMP_TEMPLATE_API BatchSlot final : public SlotConcept<void, Arguments...>
+{
+    using Base = SlotConcept<void, Arguments...>;
+
+    bool activateOverride(signal_argument_t<Arguments>... arguments) override
+    {
+        // Pass a batch of one event, holding the copy of the arguments.
+        const auto event = tuple<Arguments...>(forward<signal_argument_t<Arguments>>(arguments)...);
+        activateBatchOverride(signal_batch_t<Arguments...>(&event, 1u));
+        return true;
+    }
+
+    bool activateBatchOverride(signal_batch_t<Arguments...> events) override
+    {
+        invoke(m_function, events);
+        return true;
+    }
+
+public:
+    explicit BatchSlot(core::Signal& signal, const FunctionType& function)
+        : Base(signal)
+        , m_function(function)
+    {
+    }
+
+private:
+    FunctionType m_function;
+};
+
+template <typename FunctionType, bool PassConnection, typename... Arguments>
+class COMP_TEMPLATE_API QueuedSlot final : public SlotConcept<void, Arguments...>
+{
+    using Base = SlotConcept<void, Arguments...>;
+    using ArgumentsTuple = tuple<decay_t<Arguments>...>;
+    /// Each event is delivered once, so the copied arguments are moved to the slot, except the arguments the
+    /// signal declares by reference.
+    template <typename T>
+    using DeliveredArgument = conditional_t<is_reference_v<T>, decay_t<T>&, decay_t<T>&&>;
+
+    /// The event holding the copy of the arguments of an activation.
+    struct Envelope final : public EventLoop::Event
+    {
+        explicit Envelope(intrusive_ptr<Base> slot, signal_argument_t<Arguments>... arguments)
+            : slot(move(slot))
+            , arguments(forward<signal_argument_t<Arguments>>(arguments)...)
+        {
+        }
+
+        void dispatch() override
+        {
+            static_cast<QueuedSlot&>(*slot).deliver(arguments, index_sequence_for<Arguments...>());
+        }
+
+        intrusive_ptr<Base> slot;
+        ArgumentsTuple arguments;
+    };
+
+    bool activateOverride(signal_argument_t<Arguments>... arguments) override
+    {
+        // When the event loop is destroyed, the post fails, and the slot gets disconnected.
+        return m_queue->template post<Envelope>(intrusive_ptr<Base>(this), forward<signal_argument_t<Arguments>>(arguments)...);
+    }
+
+    template <size_t... Is>
+    void deliver(ArgumentsTuple& arguments, index_sequence<Is...>)
+    {
+        if (this->isDetached())
+        {
+            return;
+        }
+        if (!this->isConnected())
+        {
+            // One of the trackers of the slot became invalid since the emission.
+            this->autoDisconnect();
+            return;
+        }
+
+        typename Base::ActivationGuard guard(*this);
+        if (!guard)
+        {
+            return;
+        }
+        if constexpr (PassConnection)
+        {
+            invoke(m_function, Connection(ConnectionView(*this)), static_cast<DeliveredArgument<Arguments>>(get<Is>(arguments))...);
+        }
+        else
+        {
+            invoke(m_function, static_cast<DeliveredArgument<Arguments>>(get<Is>(arguments))...);
+        }
+    }
+
+public:
+    explicit QueuedSlot(core::Signal& signal, EventLoop& loop, const FunctionType& function)
+        : Base(signal)
+        , m_queue(loop.getQueue())
+        , m_function(function)
+    {
+    }
+
+private:
+    EventLoop::QueuePtr m_queue;
+    FunctionType m_function;
+};
+
 } // namespace noname
 
 template <class DerivedCollector>
 template <class SlotType, typename ReturnType, typename... Arguments>
 bool Collector<DerivedCollector>::collect(SlotType& slot, Arguments&&... arguments)
+{
+    auto result = slot.activate(forward<Arguments>(arguments)...);
+    if (!result)
+    {
+        // The slot was not activated, continue with the next slot.
+        return true;
+    }
+    return collectResult<ReturnType>(ConnectionView(slot), result);
+}
+
+template <class DerivedCollector>
+template <typename ReturnType, typename ResultType>
+bool Collector<DerivedCollector>::collectResult(ConnectionView connection, ResultType& result)
+{
+    if (!result)
+    {
+        return true;
+    }
+
+    if constexpr (is_void_v<ReturnType>)
+    {
+        return getSelf()->handleResult(connection);
+    }
+    else
+    {
+        return getSelf()->handleResult(connection, *result);
+    }
+}
+
+template <class DerivedCollector>
+template <typename ReturnType, class FunctionType, typename... Arguments>
+bool Collector<DerivedCollector>::collectCall(FunctionType&& function, Arguments&&... arguments)
 {
     if constexpr (is_void_v<ReturnType>)
     {
-        slot.activate(forward<Arguments>(arguments)...);
-        return getSelf()->handleResult(Connection(slot.shared_from_this()));
+        invoke(forward<FunctionType>(function), forward<Arguments>(arguments)...);
+        return getSelf()->handleResult(ConnectionView());
     }
     else
     {
-        auto result = slot.activate(forward<Arguments>(arguments)...);
-        return getSelf()->handleResult(Connection(slot.shared_from_this()), result);
+        return getSelf()->handleResult(ConnectionView(), invoke(forward<FunctionType>(function), forward<Arguments>(arguments)...));
     }
 }
 
 
+template <typename ReturnType, typename... Arguments>
+SignalConcept<ReturnType, Arguments...>::SignalConcept(size_t shardCount)
+    // The shards are created before the registry entry publishes the signal to the statistics snapshots.
+    : m_shards((shardCount > 1u) ? make_unique<SlotStoreType[]>(shardCount - 1u) : nullptr)
+    , m_shardCount(max(shardCount, size_t(1u)))
+{
+}
+
 template <typename ReturnType, typename... Arguments>
 SignalConcept<ReturnType, Arguments...>::~SignalConcept()
 {
-    lock_guard lock(*this);
+#ifdef COMP_CONFIG_COROUTINES_ENABLED
+    {
+        lock_guard lock(*this);
+        // The waiters are not resumed, the owner of a waiting coroutine destroys the coroutine.
+        for (auto waiter = m_waiters.exchange(nullptr); waiter; waiter = waiter->next)
+        {
+            waiter->signal = nullptr;
+        }
+        for (auto waiter = exchange(m_resumedWaiters, nullptr); waiter; waiter = waiter->next)
+        {
+            waiter->signal = nullptr;
+        }
+    }
+#endif
+
+    for (auto index = 0u; index < m_shardCount; ++index)
+    {
+        if (auto slots = getShard(index).takeAll())
+        {
+            for (auto& slot : *slots)
+            {
+                slot->disconnect();
+            }
+        }
+    }
+}
+
+template <typename ReturnType, typename... Arguments>
+typename SignalConcept<ReturnType, Arguments...>::SlotStoreType& SignalConcept<ReturnType, Arguments...>::getShard(const core::Slot<mutex>& slot)
+{
+    if (m_shardCount == 1u)
+    {
+        return m_store;
+    }
+    // Spread the slot addresses over the shards. The low bits of the address are dropped, as those are
+    // the same for every slot due to the alignment.
+    const auto hash = (reinterpret_cast<uintptr_t>(&slot) >> 4u) * uintptr_t(0x9e3779b97f4a7c15u);
+    return getShard((hash >> (sizeof(uintptr_t) * 4u)) % m_shardCount);
+}
+
+template <typename ReturnType, typename... Arguments>
+shared_ptr<const typename SignalConcept<ReturnType, Arguments...>::SlotContainer> SignalConcept<ReturnType, Arguments...>::getSlots()
+{
+    if (m_shardCount == 1u)
+    {
+        return m_store.getSlots();
+    }
+
+    shared_ptr<SlotContainer> result;
+    for (auto index = 0u; index < m_shardCount; ++index)
+    {
+        if (auto slots = getShard(index).getSlots())
+        {
+            if (!result)
+            {
+                result = make_shared<SlotContainer>();
+            }
+            result->insert(result->end(), slots->begin(), slots->end());
+        }
+    }
+    return result;
+}
 
-    while (!m_slots.empty())
+template <typename ReturnType, typename... Arguments>
+template <class Function>
+void SignalConcept<ReturnType, Arguments...>::forEachSlot(const EmitGuard& guard, Function&& function)
+{
+    const auto shardCount = m_shardCount;
+    for (auto index = 0u; index < shardCount && !guard.isSignalDestroyed(); ++index)
     {
-        relock_guard relock(*this);
-        disconnect(Connection(m_slots.back()));
+        // Take the snapshot of the slots of the shard. The snapshot is immutable, slots connected or
+        // disconnected during the emission modify a copy of the container.
+        auto slots = getShard(index).getSlots();
+        if (!slots)
+        {
+            continue;
+        }
+
+        for (auto& slot : *slots)
+        {
+            if (slot->isDetached())
+            {
+                // The slot is disconnected, and gets removed by the next compaction of the shard.
+                continue;
+            }
+            if (!slot->isConnected())
+            {
+                // One of the trackers of the slot is no longer valid. Disconnect the slot.
+                slot->autoDisconnect();
+                continue;
+            }
+
+            // A receiver that is being destroyed throws when the slot locks it. The handlers are off the path of
+            // the slots that do not throw.
+            try
+            {
+                if (!function(slot))
+                {
+                    return;
+                }
+            }
+            catch (const bad_weak_ptr&)
+            {
+                slot->autoDisconnect();
+            }
+            catch (const bad_slot&)
+            {
+                slot->autoDisconnect();
+            }
+        }
+    }
+}
+
+template <typename ReturnType, typename... Arguments>
+void SignalConcept<ReturnType, Arguments...>::notifySlotDisconnected(core::Slot<mutex>& slot)
+{
+    getShard(slot).notifySlotDisconnected();
+}
+
+template <typename ReturnType, typename... Arguments>
+bool SignalConcept<ReturnType, Arguments...>::beginEmit(size_t eventCount)
+{
+    if (isBlocked())
+    {
+#ifdef COMP_CONFIG_INSTRUMENTATION_ENABLED
+        this->getStatistics()->countBlocked();
+#endif
+        return false;
     }
+    if (this->isEmittingOnCurrentThread())
+    {
+#ifdef COMP_CONFIG_INSTRUMENTATION_ENABLED
+        this->getStatistics()->countReentrant();
+#endif
+        return false;
+    }
+
+#ifdef COMP_CONFIG_INSTRUMENTATION_ENABLED
+    this->getStatistics()->countEmit(eventCount);
+#else
+    COMP_UNUSED(eventCount);
+#endif
+    return true;
 }
 
+#ifdef COMP_CONFIG_INSTRUMENTATION_ENABLED
+template <typename ReturnType, typename... Arguments>
+void SignalConcept<ReturnType, Arguments...>::collectSlotStatistics(core::Signal& signal, vector<LatencyHistogram::Buckets>& slots)
+{
+    // Read the slots from the snapshot the emitters use, the emitters are not stopped.
+    if (auto snapshot = static_cast<SignalConcept&>(signal).getSlots())
+    {
+        for (auto& slot : *snapshot)
+        {
+            if (!slot->isDetached())
+            {
+                slots.push_back(slot->getActivationTimes().getBuckets());
+            }
+        }
+    }
+}
+#endif
+
 template <typename ReturnType, typename... Arguments>
 template <class Collector>
-Collector SignalConcept<ReturnType, Arguments...>::operator()(Arguments... arguments)
+Collector SignalConcept<ReturnType, Arguments...>::operator()(signal_argument_t<Arguments>... arguments)
 {
     auto context = Collector();
+    emit(context, forward<signal_argument_t<Arguments>>(arguments)...);
+    return context;
+}
 
-    if (isBlocked() || m_emitGuard.isLocked())
+template <typename ReturnType, typename... Arguments>
+template <class Collector>
+Collector& SignalConcept<ReturnType, Arguments...>::emit(Collector& context, signal_argument_t<Arguments>... arguments)
+{
+    if (!beginEmit())
     {
         return context;
     }
 
-    lock_guard guard(m_emitGuard);
+    EmitGuard guard(*this);
 
-    SlotContainer slots;
+    auto activateSlot = [&context, &arguments...](auto& slot)
     {
-        lock_guard lock(*this);
-        // Remove disconnected slots.
-        erase_if(m_slots, [](auto& slot) { return !slot || !slot->isConnected(); });
-        // Copyt the slots now.
-        slots = m_slots;
-    }
+        return context.template collect<SlotType, ReturnType, signal_argument_t<Arguments>...>(*slot, forward<signal_argument_t<Arguments>>(arguments)...);
+    };
+    forEachSlot(guard, activateSlot);
 
-    for (auto& s : slots)
+#ifdef COMP_CONFIG_COROUTINES_ENABLED
+    if (!guard.isSignalDestroyed())
     {
-        auto slot = static_pointer_cast<SlotType>(s);
-        lock_guard lock(*slot);
+        resumeWaiters(guard, forward<signal_argument_t<Arguments>>(arguments)...);
+    }
+#endif
 
-        try
+    return context;
+}
+
+#ifdef COMP_CONFIG_COROUTINES_ENABLED
+template <typename ReturnType, typename... Arguments>
+void SignalConcept<ReturnType, Arguments...>::addWaiter(Waiter& waiter)
+{
+    lock_guard lock(*this);
+    COMP_ASSERT(!waiter.signal);
+    waiter.signal = this;
+    waiter.next = m_waiters.load(memory_order_relaxed);
+    m_waiters.store(&waiter);
+}
+
+template <typename ReturnType, typename... Arguments>
+void SignalConcept<ReturnType, Arguments...>::removeWaiter(Waiter& waiter)
+{
+    lock_guard lock(*this);
+    if (waiter.signal != this)
+    {
+        // The waiter is resumed, or the signal is destroyed.
+        return;
+    }
+    waiter.signal = nullptr;
+    if (m_waiters.load(memory_order_relaxed) == &waiter)
+    {
+        m_waiters.store(waiter.next);
+        return;
+    }
+    if (m_resumedWaiters == &waiter)
+    {
+        m_resumedWaiters = waiter.next;
+        return;
+    }
+    // The waiter is either parked, or taken by an emission to resume.
+    Waiter* lists[] = {m_waiters.load(memory_order_relaxed), m_resumedWaiters};
+    for (auto list : lists)
+    {
+        for (auto previous = list; previous; previous = previous->next)
         {
-            if (!slot->isConnected())
+            if (previous->next == &waiter)
             {
-                // The slot is already disconnected from the signal, most likely due to this signal deletion.
-                continue;
+                previous->next = waiter.next;
+                return;
             }
-            relock_guard relock(*slot);
-            if (!context.template collect<SlotType, ReturnType, Arguments...>(*slot, forward<Arguments>(arguments)...))
+        }
+    }
+}
+
+template <typename ReturnType, typename... Arguments>
+void SignalConcept<ReturnType, Arguments...>::resumeWaiters(const EmitGuard& guard, signal_argument_t<Arguments>... arguments)
+{
+    if (!m_waiters.load(memory_order_acquire))
+    {
+        return;
+    }
+
+    // Take the parked waiters, in the order they were parked. Waiters parked during the resume wait for
+    // the next emission. The waiters taken by an other emission in progress are resumed by either emission.
+    {
+        lock_guard lock(*this);
+        Waiter* waiters = nullptr;
+        for (auto waiter = m_waiters.exchange(nullptr); waiter; )
+        {
+            auto next = exchange(waiter->next, waiters);
+            waiters = exchange(waiter, next);
+        }
+        auto tail = &m_resumedWaiters;
+        while (*tail)
+        {
+            tail = &(*tail)->next;
+        }
+        *tail = waiters;
+    }
+
+    // Take one waiter at a time, as the resumed waiter may destroy the waiters not yet resumed.
+    while (!guard.isSignalDestroyed())
+    {
+        Waiter* waiter = nullptr;
+        {
+            lock_guard lock(*this);
+            waiter = m_resumedWaiters;
+            if (!waiter)
             {
                 break;
             }
+            m_resumedWaiters = waiter->next;
+            waiter->signal = nullptr;
         }
-        catch (const bad_weak_ptr&)
+        waiter->resume(*waiter, forward<signal_argument_t<Arguments>>(arguments)...);
+    }
+}
+#endif
+
+template <typename ReturnType, typename... Arguments>
+template <class Collector>
+Collector SignalConcept<ReturnType, Arguments...>::emitBatch(signal_batch_t<Arguments...> events)
+{
+    auto context = Collector();
+
+    if (events.empty() || !beginEmit(events.size()))
+    {
+        return context;
+    }
+
+    EmitGuard guard(*this);
+
+    // The slots are walked once for the whole batch.
+    auto activateSlot = [&context, &events](auto& slot)
+    {
+        const auto connection = ConnectionView(*slot);
+        auto handleResult = [&context, &connection](auto& result)
         {
-            relock_guard relock(*slot);
-            disconnect(Connection(slot));
+            return context.template collectResult<ReturnType>(connection, result);
+        };
+        return slot->activateBatch(events, handleResult);
+    };
+    forEachSlot(guard, activateSlot);
+
+    return context;
+}
+
+#ifdef COMP_CONFIG_THREAD_ENABLED
+/// The state of an asynchronous emission, shared by the tasks activating the slots.
+template <typename ReturnType, typename... Arguments>
+template <class Collector>
+struct SignalConcept<ReturnType, Arguments...>::AsyncEmission
+{
+    using ActivationResult = typename SlotType::ActivationResult;
+
+    /// The result of a slot activation.
+    struct SlotResult
+    {
+        ActivationResult value = {};
+        exception_ptr error;
+    };
+
+    explicit AsyncEmission(const SignalConcept& signal, shared_ptr<const SlotContainer> slots, signal_argument_t<Arguments>... arguments)
+        : signal(signal)
+        , slots(move(slots))
+        , arguments(forward<signal_argument_t<Arguments>>(arguments)...)
+        , results(this->slots->size())
+    {
+    }
+
+    /// Activates the slot at \a index. The task that activates the last slot collects the results.
+    void activate(size_t index)
+    {
+        activate(index, index_sequence_for<Arguments...>());
+        if (pendingCount.fetch_sub(1u) == 1u)
+        {
+            complete();
         }
-        catch (const bad_slot&)
+    }
+
+    template <size_t... Is>
+    void activate(size_t index, index_sequence<Is...>)
+    {
+        auto& slot = (*slots)[index];
+        if (!slot->isConnected())
+        {
+            // One of the trackers of the slot is no longer valid. Disconnect the slot.
+            slot->autoDisconnect();
+            return;
+        }
+
+        EmitGuard guard(signal);
+        try
         {
-            relock_guard relock(*slot);
-            disconnect(Connection(slot));
+            results[index].value = slot->activate(forward<signal_argument_t<Arguments>>(get<Is>(arguments))...);
+        }
+        catch (...)
+        {
+            results[index].error = current_exception();
         }
     }
 
-    return context;
+    /// Collects the results of the slots in connection order, and resolves the future.
+    void complete()
+    {
+        try
+        {
+            auto collector = Collector();
+            for (auto index = 0u; index < results.size(); ++index)
+            {
+                if (results[index].error)
+                {
+                    promise.set_exception(results[index].error);
+                    return;
+                }
+                if (!collector.template collectResult<ReturnType>(ConnectionView(*(*slots)[index]), results[index].value))
+                {
+                    break;
+                }
+            }
+            promise.set_value(move(collector));
+        }
+        catch (...)
+        {
+            promise.set_exception(current_exception());
+        }
+    }
+
+    /// The emitting signal. Used only to identify the emission, the signal may be destroyed before the
+    /// emission completes.
+    const SignalConcept& signal;
+    shared_ptr<const SlotContainer> slots;
+    tuple<Arguments...> arguments;
+    vector<SlotResult> results;
+    atomic<size_t> pendingCount = 0u;
+    comp::promise<Collector> promise;
+};
+
+template <typename ReturnType, typename... Arguments>
+template <class Collector>
+future<Collector> SignalConcept<ReturnType, Arguments...>::emitAsync(Executor& executor, signal_argument_t<Arguments>... arguments)
+{
+    auto slots = beginEmit() ? getSlots() : nullptr;
+    if (!slots)
+    {
+        promise<Collector> ready;
+        ready.set_value(Collector());
+        return ready.get_future();
+    }
+
+    auto emission = make_shared<AsyncEmission<Collector>>(*this, slots, forward<signal_argument_t<Arguments>>(arguments)...);
+    auto result = emission->promise.get_future();
+
+    // Dispatch the slots that are not disconnected. Count the tasks before dispatching any, so a task that
+    // completes early does not resolve the future.
+    vector<size_t> indexes;
+    indexes.reserve(slots->size());
+    for (auto index = 0u; index < slots->size(); ++index)
+    {
+        if (!(*slots)[index]->isDetached())
+        {
+            indexes.push_back(index);
+        }
+    }
+    if (indexes.empty())
+    {
+        emission->complete();
+        return result;
+    }
+
+    emission->pendingCount = indexes.size();
+    for (auto index : indexes)
+    {
+        executor.execute([emission, index]()
+        {
+            emission->activate(index);
+        });
+    }
+    return result;
 }
+#endif
 
 template <typename ReturnType, typename... Arguments>
-Connection SignalConcept<ReturnType, Arguments...>::addSlot(SlotPtr slot)
+Connection SignalConcept<ReturnType, Arguments...>::addSlot(SlotPtr slot, int priority)
 {
-    auto slotActivator = dynamic_pointer_cast<SlotType>(slot);
+    auto slotActivator = SlotTypePtr(dynamic_cast<SlotType*>(slot.get()));
     COMP_ASSERT(slotActivator);
-    lock_guard lock(*this);
-    m_slots.push_back(slotActivator);
-    return Connection(m_slots.back());
+    slotActivator->m_priority = priority;
+    getShard(*slotActivator).add(slotActivator);
+    return Connection(slotActivator);
 }
 
 template <typename ReturnType, typename... Arguments>
 template <class FunctionType>
 enable_if_t<is_member_function_pointer_v<FunctionType>, Connection>
 SignalConcept<ReturnType, Arguments...>::connect(shared_ptr<typename function_traits<FunctionType>::object> receiver, FunctionType method)
+{
+    return connect(0, receiver, method);
+}
+
+template <typename ReturnType, typename... Arguments>
+template <class FunctionType>
+enable_if_t<is_member_function_pointer_v<FunctionType>, Connection>
+SignalConcept<ReturnType, Arguments...>::connect(int priority, shared_ptr<typename function_traits<FunctionType>::object> receiver, FunctionType method)
 {
     using Object = typename function_traits<FunctionType>::object;
     using SlotReturnType = typename function_traits<FunctionType>::return_type;
 
     static_assert(
-        (function_traits<FunctionType>::template is_same_args<Arguments...> || function_traits<FunctionType>::template is_same_args<Connection, Arguments...>) &&
+        (is_slot_signature_v<FunctionType, Arguments...> ||
+         is_slot_signature_v<FunctionType, Connection, Arguments...> ||
+         is_slot_signature_v<FunctionType, ConnectionView, Arguments...>) &&
         is_same_v<ReturnType, SlotReturnType>,
         "Incompatible slot signature");
 
-    auto slot = make_shared<core::Slot<mutex>, MethodSlot<Object, FunctionType, SlotReturnType, Arguments...>>(*this, receiver, method);
-    return addSlot(slot).bind(receiver);
+    auto slot = core::Slot<mutex>::create<MethodSlot<Object, FunctionType, SlotReturnType, Arguments...>>(getMemoryResource(), *this, receiver, method);
+    return addSlot(slot, priority);
 }
 
 template <typename ReturnType, typename... Arguments>
 template <class FunctionType>
 enable_if_t<!is_base_of_v<SignalConcept<ReturnType, Arguments...>, FunctionType>, Connection>
 SignalConcept<ReturnType, Arguments...>::connect(const FunctionType& function)
+{
+    return connect(0, function);
+}
+
+template <typename ReturnType, typename... Arguments>
+template <class FunctionType>
+enable_if_t<!is_base_of_v<SignalConcept<ReturnType, Arguments...>, FunctionType>, Connection>
+SignalConcept<ReturnType, Arguments...>::connect(int priority, const FunctionType& function)
 {
     using SlotReturnType = typename function_traits<FunctionType>::return_type;
     static_assert(
-        (function_traits<FunctionType>::template is_same_args<Arguments...> || function_traits<FunctionType>::template is_same_args<Connection, Arguments...>) &&
+        (is_slot_signature_v<FunctionType, Arguments...> ||
+         is_slot_signature_v<FunctionType, Connection, Arguments...> ||
+         is_slot_signature_v<FunctionType, ConnectionView, Arguments...>) &&
         is_same_v<ReturnType, SlotReturnType>,
         "Incompatible slot signature");
 
-    auto slot = make_shared<core::Slot<mutex>, FunctionSlot<FunctionType, SlotReturnType, Arguments...>>(*this, function);
+    auto slot = core::Slot<mutex>::create<FunctionSlot<FunctionType, SlotReturnType, Arguments...>>(getMemoryResource(), *this, function);
+    return addSlot(slot, priority);
+}
+
+template <typename ReturnType, typename... Arguments>
+template <class FunctionType>
+Connection SignalConcept<ReturnType, Arguments...>::connectBatch(const FunctionType& function)
+{
+    static_assert(is_void_v<ReturnType>, "Batch connections require a signal with void return type");
+    static_assert(is_invocable_r_v<void, const FunctionType&, signal_batch_t<Arguments...>>, "Incompatible slot signature");
+
+    auto slot = core::Slot<mutex>::create<BatchSlot<FunctionType, Arguments...>>(getMemoryResource(), *this, function);
+    return addSlot(slot);
+}
+
+template <typename ReturnType, typename... Arguments>
+template <class FunctionType>
+enable_if_t<!is_member_function_pointer_v<FunctionType>, Connection>
+SignalConcept<ReturnType, Arguments...>::connect(EventLoop& loop, const FunctionType& function)
+{
+    using SlotReturnType = typename function_traits<FunctionType>::return_type;
+    static_assert(is_void_v<ReturnType>, "Queued connections require a signal with void return type");
+    static_assert(
+        (is_slot_signature_v<FunctionType, Arguments...> || is_slot_signature_v<FunctionType, Connection, Arguments...>) &&
+        is_void_v<SlotReturnType>,
+        "Incompatible slot signature");
+
+    constexpr auto passConnection = is_slot_signature_v<FunctionType, Connection, Arguments...>;
+    auto slot = core::Slot<mutex>::create<QueuedSlot<FunctionType, passConnection, Arguments...>>(getMemoryResource(), *this, loop, function);
     return addSlot(slot);
 }
 
+template <typename ReturnType, typename... Arguments>
+template <class FunctionType>
+enable_if_t<is_member_function_pointer_v<FunctionType>, Connection>
+SignalConcept<ReturnType, Arguments...>::connect(EventLoop& loop, shared_ptr<typename function_traits<FunctionType>::object> receiver, FunctionType method)
+{
+    using Object = typename function_traits<FunctionType>::object;
+    using SlotReturnType = typename function_traits<FunctionType>::return_type;
+    static_assert(is_void_v<ReturnType>, "Queued connections require a signal with void return type");
+    static_assert(
+        (is_slot_signature_v<FunctionType, Arguments...> || is_slot_signature_v<FunctionType, Connection, Arguments...>) &&
+        is_void_v<SlotReturnType>,
+        "Incompatible slot signature");
+
+    // The receiver is tracked, so the event is dropped if the receiver is destroyed before the delivery.
+    auto function = [target = weak_ptr<Object>(receiver), method](auto&&... arguments)
+    {
+        if (auto object = target.lock())
+        {
+            invoke(method, object, forward<decltype(arguments)>(arguments)...);
+        }
+    };
+    constexpr auto passConnection = is_slot_signature_v<FunctionType, Connection, Arguments...>;
+    auto slot = core::Slot<mutex>::create<QueuedSlot<decltype(function), passConnection, Arguments...>>(getMemoryResource(), *this, loop, function);
+    return addSlot(slot).bind(receiver);
+}
+
 template <typename ReturnType, typename... Arguments>
 Connection SignalConcept<ReturnType, Arguments...>::connect(SignalConcept& receiver)
+{
+    return connect(0, receiver);
+}
+
+template <typename ReturnType, typename... Arguments>
+Connection SignalConcept<ReturnType, Arguments...>::connect(int priority, SignalConcept& receiver)
 {
     using ReceiverSignal = SignalConcept;
-    auto slot = make_shared<core::Slot<mutex>, SignalSlot<ReceiverSignal, ReturnType, Arguments...>>(*this, receiver);
+    auto slot = core::Slot<mutex>::create<SignalSlot<ReceiverSignal, ReturnType, Arguments...>>(getMemoryResource(), *this, receiver);
     receiver.track(Connection(slot));
-    return addSlot(slot);
+    return addSlot(slot, priority);
 }
 
 template <typename ReturnType, typename... Arguments>
 void SignalConcept<ReturnType, Arguments...>::disconnect(Connection connection)
 {
     auto slot = connection.get();
-    if (!slot)
+    if (!slot || slot->getSignal() != this)
     {
         return;
     }
-    else
-    {
-        lock_guard lock(*this);
-        auto it = find(m_slots, slot);
-        if (it == m_slots.end())
-        {
-            return;
-        }
-        erase(m_slots, slot);
-    }
-    connection.disconnect();
+    slot->disconnect();
 }
 
 } // namespace comp
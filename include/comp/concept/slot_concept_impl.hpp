@@ -2,7 +2,6 @@
 #define COMP_CONNECTION_IMPL_HPP
 
 #include <comp/concept/signal.hpp>
-#include <comp/wrap/exception.hpp>
 #include <comp/wrap/intrusive_ptr.hpp>
 
 namespace comp
@@ -29,56 +28,54 @@ constexpr bool is_valid_trackable_arg = (
             );
 
 template <typename TrackedType>
-struct SlotTracker final : public core::Slot<mutex>::TrackerInterface
+struct SlotTracker;
+
+/// The trackers of ConnectionTracker objects link the connection to the ConnectionTracker.
+struct NoLink
+{
+    explicit NoLink(Connection)
+    {
+    }
+};
+
+template <typename TrackedType>
+using SlotTrackerLink = conditional_t<is_trackable_class_v<typename pointer_traits<TrackedType>::element_type>, TrackerLink, NoLink>;
+
+// The link is a base, so the trackers without link take no space for it, and fit the inline tracker storage
+// of the slot.
+template <typename TrackedType>
+struct SlotTracker final : public core::Slot<mutex>::TrackerInterface, public SlotTrackerLink<TrackedType>
 {
-    using Base = typename core::Slot<mutex>::TrackerInterface;
     using ManagedType = typename pointer_traits<TrackedType>::element_type;
     using PointerType = conditional_t<is_shared_ptr_v<TrackedType>, weak_ptr<ManagedType>, TrackedType>;
+    using LinkType = SlotTrackerLink<TrackedType>;
     static constexpr bool isTracker = is_trackable_class_v<ManagedType>;
 
-    Connection connection;
     PointerType tracked;
 
-    static auto create(Connection connection, TrackedType tracked)
+    explicit SlotTracker(Connection connection, TrackedType tracked)
+        : LinkType(connection)
+        , tracked(tracked)
     {
-        auto tracker = make_shared<Base, SlotTracker>(connection, tracked);
         if constexpr (isTracker)
         {
-            tracked->track(connection);
+            LinkType::link(*tracked);
         }
-        return tracker;
     }
 
-    explicit SlotTracker(Connection connection, TrackedType tracked)
-        : connection(connection)
-        , tracked(tracked)
-    {
-    }
-    ~SlotTracker()
-    {
-        untrack();
-    }
-
-    void untrack()
+    const void* getConnectionTracker() const override
     {
         if constexpr (isTracker)
         {
-            if constexpr (is_weak_ptr_v<PointerType>)
-            {
-                auto lock = tracked.lock();
-                if (lock)
-                {
-                    lock->untrack(connection);
-                }
-            }
-            else
-            {
-                tracked->untrack(connection);
-            }
+            return this->getOwner();
+        }
+        else
+        {
+            return nullptr;
         }
     }
 
-    bool isValid() const
+    bool isValid() const override
     {
         if constexpr (is_pointer_v<TrackedType>)
         {
@@ -86,35 +83,150 @@ struct SlotTracker final : public core::Slot<mutex>::TrackerInterface
         }
         else if constexpr (is_weak_ptr_v<PointerType>)
         {
-            return tracked.lock() != nullptr;
+            return !tracked.expired();
         }
         else
         {
             return tracked;
         }
     }
+
+    size_t getSize() const override
+    {
+        return sizeof(SlotTracker);
+    }
+
+    // The ConnectionTracker objects held by pointer disconnect the slot on destruction. The expiry of
+    // a shared pointer has no notification, so those trackers are polled.
+    bool isPolled() const override
+    {
+        return is_weak_ptr_v<PointerType>;
+    }
 };
 
+static_assert(sizeof(SlotTracker<shared_ptr<ConnectionTracker>>) <= core::Slot<mutex>::inlineTrackerSize, "The largest tracker does not fit the inline tracker storage");
+
 } // noname
 
 
 
 template <typename ReturnType, typename... Arguments>
-ReturnType SlotConcept<ReturnType, Arguments...>::activate(Arguments&&... args)
+typename SlotConcept<ReturnType, Arguments...>::ActivationResult SlotConcept<ReturnType, Arguments...>::activate(signal_argument_t<Arguments>... args)
 {
-    if (!this->isConnected())
+    ActivationGuard guard(*this);
+    if (!guard)
     {
-        throw bad_slot();
+        return {};
     }
 
-    return activateOverride(forward<Arguments>(args)...);
+#ifdef COMP_CONFIG_INSTRUMENTATION_ENABLED
+    const auto start = chrono::steady_clock::now();
+#endif
+    auto result = activateOverride(forward<signal_argument_t<Arguments>>(args)...);
+    if (!result)
+    {
+        // The receiver of the slot is destroyed.
+        autoDisconnect();
+        return result;
+    }
+#ifdef COMP_CONFIG_INSTRUMENTATION_ENABLED
+    recordActivation(start);
+#endif
+    return result;
 }
 
+template <typename ReturnType, typename... Arguments>
+template <class ResultHandler>
+bool SlotConcept<ReturnType, Arguments...>::activateBatch(signal_batch_t<Arguments...> events, ResultHandler&& handleResult)
+{
+    ActivationGuard guard(*this);
+    if (!guard)
+    {
+        return true;
+    }
+
+    if constexpr (is_void_v<ReturnType>)
+    {
+#ifdef COMP_CONFIG_INSTRUMENTATION_ENABLED
+        const auto start = chrono::steady_clock::now();
+#endif
+        if (activateBatchOverride(events))
+        {
+#ifdef COMP_CONFIG_INSTRUMENTATION_ENABLED
+            recordActivation(start, events.size());
+#endif
+            // Report an activation for each event of the batch.
+            for (auto index = 0u; index < events.size(); ++index)
+            {
+                auto result = ActivationResult(true);
+                if (!handleResult(result))
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+    }
+
+    auto activateEvent = [this](auto&... arguments)
+    {
+        return activateOverride(arguments...);
+    };
+    for (auto& event : events)
+    {
+        if (this->isDetached())
+        {
+            // The slot got disconnected by one of the events.
+            break;
+        }
+#ifdef COMP_CONFIG_INSTRUMENTATION_ENABLED
+        const auto start = chrono::steady_clock::now();
+#endif
+        auto result = apply(activateEvent, event);
+        if (!result)
+        {
+            // The receiver of the slot is destroyed.
+            autoDisconnect();
+            break;
+        }
+#ifdef COMP_CONFIG_INSTRUMENTATION_ENABLED
+        recordActivation(start);
+#endif
+        if (!handleResult(result))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+template <typename ReturnType, typename... Arguments>
+void SlotConcept<ReturnType, Arguments...>::autoDisconnect()
+{
+#ifdef COMP_CONFIG_INSTRUMENTATION_ENABLED
+    if (!this->isDetached())
+    {
+        m_statistics->countAutoDisconnect();
+    }
+#endif
+    disconnect();
+}
+
+#ifdef COMP_CONFIG_INSTRUMENTATION_ENABLED
+template <typename ReturnType, typename... Arguments>
+void SlotConcept<ReturnType, Arguments...>::recordActivation(chrono::steady_clock::time_point start, size_t count)
+{
+    // A batch slot activated with several events records the time of the whole batch.
+    m_activationTimes.record(chrono::steady_clock::now() - start);
+    m_statistics->countActivation(count);
+}
+#endif
+
 template <class... Trackers>
 Connection& Connection::bind(Trackers... trackers)
 {
     COMP_ASSERT(*this);
-    auto slot = m_slot.lock();
+    auto slot = get();
     COMP_ASSERT(slot);
 
     auto binder = [this, &slot](auto tracker)
@@ -125,12 +237,28 @@ Connection& Connection::bind(Trackers... trackers)
     return *this;
 }
 
+inline void Tracker<Connection>::track(Connection connection)
+{
+    if (connection)
+    {
+        connection.bind(this);
+    }
+}
+
+inline void Tracker<Connection>::untrack(Connection connection)
+{
+    if (auto slot = connection.get())
+    {
+        slot->removeTracker(this);
+    }
+}
+
 template <class TrackerType>
 void Connection::bindOne(SlotPtr slot, TrackerType tracker)
 {
     static_assert (is_valid_trackable_arg<TrackerType>, "Invalid trackable");
 
-    slot->addTracker(SlotTracker<TrackerType>::create(*this, tracker));
+    slot->template addTracker<SlotTracker<TrackerType>>(*this, tracker);
 }
 
 } // namespace comp
@@ -0,0 +1,190 @@
+#ifndef COMP_SLOT_STORE_HPP
+#define COMP_SLOT_STORE_HPP
+
+#include <comp/config.hpp>
+#include <comp/utility/lockable.hpp>
+#include <comp/wrap/algorithm.hpp>
+#include <comp/wrap/atomic.hpp>
+#include <comp/wrap/intrusive_ptr.hpp>
+#include <comp/wrap/memory.hpp>
+#include <comp/wrap/mutex.hpp>
+#include <comp/wrap/thread.hpp>
+#include <comp/wrap/utility.hpp>
+#include <comp/wrap/vector.hpp>
+
+namespace comp
+{
+
+/// The SlotStore holds the slots connected to a signal. The slots are kept in a copy-on-write container: the
+/// emitters take an immutable snapshot of the container, and walk the snapshot without holding the lock. Slots
+/// connected or disconnected while an emitter holds the snapshot modify a copy of the container.
+///
+/// The lock of the store serializes the writers. The emitters take the snapshot without locking, unless a writer
+/// modifies the store at the same time, in which case the emitter waits for the writer on the lock.
+///
+/// The container is ordered by the priority of the slots, the slots with higher priority first, and the slots
+/// with the same priority in the order they were added. The emitters walk the container without sorting.
+///
+/// Disconnecting a slot takes constant time: the slot is marked disconnected, and removed from the store
+/// once the disconnected slots take half of the container.
+/// \tparam SlotType The type of the slots held by the store.
+template <class SlotType>
+class COMP_TEMPLATE_API SlotStore : public Lockable<mutex>
+{
+public:
+    using SlotTypePtr = intrusive_ptr<SlotType>;
+    using Container = vector<SlotTypePtr>;
+
+    /// Constructor.
+    explicit SlotStore() = default;
+
+    /// Returns the snapshot of the slots. The snapshot may hold disconnected slots, which the emitters skip.
+    /// \return The snapshot of the slots. Returns \e nullptr if the store has no slots.
+    shared_ptr<const Container> getSlots()
+    {
+#ifdef COMP_CONFIG_THREAD_ENABLED
+        // The writers wait for the readers that copy the snapshot before they modify the store.
+        m_readerCount.fetch_add(1u);
+        if (!m_isWriting.load())
+        {
+            auto slots = shared_ptr<const Container>(m_slots);
+            m_readerCount.fetch_sub(1u, memory_order_release);
+            return slots;
+        }
+        m_readerCount.fetch_sub(1u, memory_order_release);
+#endif
+        lock_guard lock(*this);
+        return m_slots;
+    }
+
+    /// Adds a \a slot to the store, after the slots with the same or higher priority. Adding a slot with
+    /// a priority not higher than the priority of the last slot appends the slot.
+    void add(SlotTypePtr slot)
+    {
+        lock_guard lock(*this);
+        WriteGuard guard(*this);
+        auto& slots = detach();
+        const auto priority = slot->getPriority();
+        if (slots.empty() || slots.back()->getPriority() >= priority)
+        {
+            slots.push_back(move(slot));
+            return;
+        }
+
+        auto isLowerPriority = [](int priority, const SlotTypePtr& slot)
+        {
+            return priority > slot->getPriority();
+        };
+        auto position = upper_bound(slots.begin(), slots.end(), priority, isLowerPriority);
+        slots.insert(position, move(slot));
+    }
+
+    /// Counts a disconnected slot, and compacts the container when the disconnected slots take half of the
+    /// container. The compaction runs on the thread that disconnects the slot, and its cost is amortized over
+    /// the disconnects.
+    void notifySlotDisconnected()
+    {
+        lock_guard lock(*this);
+        ++m_disconnectedCount;
+        if (m_slots && m_disconnectedCount * 2u >= m_slots->size())
+        {
+            compact();
+        }
+    }
+
+    /// Removes the slots from the store.
+    /// \return The container with the removed slots. Returns \e nullptr if the store had no slots.
+    shared_ptr<Container> takeAll()
+    {
+        lock_guard lock(*this);
+        WriteGuard guard(*this);
+        m_disconnectedCount = 0u;
+        return exchange(m_slots, nullptr);
+    }
+
+private:
+    /// Keeps the lock-free readers away from the store while a writer modifies the store. Create the guard
+    /// with the store locked.
+    class WriteGuard
+    {
+        SlotStore& m_store;
+
+        COMP_DISABLE_COPY_OR_MOVE(WriteGuard)
+
+    public:
+        explicit WriteGuard(SlotStore& store)
+            : m_store(store)
+        {
+#ifdef COMP_CONFIG_THREAD_ENABLED
+            // The readers arriving after the flag is set wait on the lock, wait for the readers that missed it.
+            m_store.m_isWriting.store(true);
+            while (m_store.m_readerCount.load() > 0u)
+            {
+                this_thread::yield();
+            }
+#endif
+        }
+        ~WriteGuard()
+        {
+#ifdef COMP_CONFIG_THREAD_ENABLED
+            m_store.m_isWriting.store(false, memory_order_release);
+#endif
+        }
+    };
+
+    /// Returns the container for modification. If the container is shared with emitters, the container is
+    /// copied before modification. Call this method with the store locked.
+    Container& detach()
+    {
+        if (!m_slots)
+        {
+            m_slots = make_shared<Container>();
+        }
+#ifdef COMP_THREAD_SANITIZER
+        else
+        {
+            // The sanitizer does not see the fence that orders the reads of the released snapshots before the
+            // modification, copy the container unconditionally.
+            m_slots = make_shared<Container>(*m_slots);
+        }
+#else
+        else if (m_slots.use_count() > 1)
+        {
+            // An emitter holds the snapshot, copy the container.
+            m_slots = make_shared<Container>(*m_slots);
+        }
+        else
+        {
+            // The use count is read relaxed. Synchronize with the emitters that released the snapshot, so their
+            // reads of the container happen before the modification.
+            atomic_thread_fence(memory_order_acquire);
+        }
+#endif
+        return *m_slots;
+    }
+
+    /// Removes the disconnected slots from the container. Call this method with the store locked.
+    void compact()
+    {
+        WriteGuard guard(*this);
+        m_disconnectedCount = 0u;
+        auto isDetached = [](auto& slot)
+        {
+            return slot->isDetached();
+        };
+        comp::erase_if(detach(), isDetached);
+    }
+
+    shared_ptr<Container> m_slots;
+    size_t m_disconnectedCount = 0u;
+#ifdef COMP_CONFIG_THREAD_ENABLED
+    /// The number of readers copying the snapshot without locking.
+    atomic<size_t> m_readerCount = 0u;
+    /// Set while a writer modifies the store.
+    atomic<bool> m_isWriting = false;
+#endif
+};
+
+} // namespace comp
+
+#endif // COMP_SLOT_STORE_HPP
@@ -63,6 +63,20 @@
 #include <mutex>
 #endif
 
+// Thread sanitizer builds. The sanitizer does not model standalone fences, the code synchronizing through
+// fences takes a path the sanitizer can check.
+#if defined(__SANITIZE_THREAD__)
+#   define COMP_THREAD_SANITIZER
+#elif defined(__has_feature)
+#   if __has_feature(thread_sanitizer)
+#       define COMP_THREAD_SANITIZER
+#   endif
+#endif
+
+#if defined(COMP_CONFIG_COROUTINES_ENABLED) && !defined(__cpp_impl_coroutine)
+#error "Coroutine support requires a C++20 compiler."
+#endif
+
 #ifdef COMP_CONFIG_LIBRARY
 #   define COMP_API     COMP_DECL_EXPORT
 #else
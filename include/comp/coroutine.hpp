@@ -0,0 +1,125 @@
+#ifndef COMP_COROUTINE_HPP
+#define COMP_COROUTINE_HPP
+
+#include <comp/config.hpp>
+
+#ifdef COMP_CONFIG_COROUTINES_ENABLED
+
+#include <comp/signal.hpp>
+#include <comp/wrap/coroutine.hpp>
+#include <comp/wrap/optional.hpp>
+#include <comp/wrap/tuple.hpp>
+#include <comp/wrap/type_traits.hpp>
+
+namespace comp
+{
+
+/// The SignalAwaiter suspends a coroutine until the next emission of a signal. The coroutine is resumed
+/// by the emitting thread, after the slots of the signal are activated, and the co_await expression gives
+/// the arguments of the emission:
+/// - nothing, if the signal has no arguments,
+/// - the copy of the argument, if the signal has a single argument,
+/// - a tuple with the copies of the arguments otherwise.
+///
+/// The awaiter is the node with which the coroutine parks on the signal, so awaiting a signal takes no
+/// allocation. The coroutine is not resumed if the signal is destroyed, or if the signal is blocked. The
+/// resumed coroutine runs within the emission, so emitting the same signal from the coroutine before its
+/// next suspension does nothing. If the coroutine is destroyed while it awaits a signal, the awaiter
+/// leaves the signal.
+template <typename ReturnType, typename... Arguments>
+class COMP_TEMPLATE_API SignalAwaiter : private SignalConcept<ReturnType, Arguments...>::Waiter
+{
+    using SignalType = SignalConcept<ReturnType, Arguments...>;
+    using Waiter = typename SignalType::Waiter;
+
+    template <typename... Types>
+    struct Result
+    {
+        using type = tuple<decay_t<Types>...>;
+    };
+    template <typename Type>
+    struct Result<Type>
+    {
+        using type = decay_t<Type>;
+    };
+
+public:
+    /// The type the co_await expression gives.
+    using ResultType = conditional_t<sizeof...(Arguments) == 0u, void, typename Result<Arguments...>::type>;
+
+    /// Constructs the awaiter of a \a signal.
+    explicit SignalAwaiter(SignalType& signal)
+        : Waiter(&SignalAwaiter::resumeWaiter)
+        , m_signal(&signal)
+    {
+    }
+
+    /// Destructor. Removes the awaiter from the signal, if the awaiter is parked on the signal.
+    ~SignalAwaiter()
+    {
+        // The signal clears the parked state when it resumes the awaiter, or when it gets destroyed.
+        if (auto signal = Waiter::signal)
+        {
+            signal->removeWaiter(*this);
+        }
+    }
+
+    COMP_DISABLE_COPY_OR_MOVE(SignalAwaiter)
+
+    bool await_ready() const noexcept
+    {
+        return false;
+    }
+
+    void await_suspend(coroutine_handle<> handle)
+    {
+        m_handle = handle;
+        // The signal may resume the coroutine on an other thread before this call returns, do not touch the
+        // awaiter after parking it.
+        m_signal->addWaiter(*this);
+    }
+
+    ResultType await_resume()
+    {
+        if constexpr (sizeof...(Arguments) > 0u)
+        {
+            return move(*m_result);
+        }
+    }
+
+private:
+    static void resumeWaiter(Waiter& waiter, signal_argument_t<Arguments>... arguments)
+    {
+        auto& self = static_cast<SignalAwaiter&>(waiter);
+        if constexpr (sizeof...(Arguments) > 0u)
+        {
+            self.m_result.emplace(forward<signal_argument_t<Arguments>>(arguments)...);
+        }
+        self.m_handle.resume();
+    }
+
+    struct Empty
+    {
+    };
+    using ResultStorage = conditional_t<sizeof...(Arguments) == 0u, Empty, optional<typename Result<Arguments...>::type>>;
+
+    SignalType* m_signal = nullptr;
+    coroutine_handle<> m_handle;
+    [[no_unique_address]] ResultStorage m_result;
+};
+
+/// Awaits the next emission of a \a signal.
+/// \param signal The signal to await.
+/// \return The awaiter of the signal.
+/// \see SignalAwaiter
+template <typename ReturnType, typename... Arguments>
+SignalAwaiter<ReturnType, Arguments...> operator co_await(SignalConcept<ReturnType, Arguments...>& signal)
+{
+    return SignalAwaiter<ReturnType, Arguments...>(signal);
+}
+
+} // namespace comp
+
+#endif
+
+#endif // COMP_COROUTINE_HPP
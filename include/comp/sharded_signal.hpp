@@ -0,0 +1,58 @@
+#ifndef COMP_SHARDED_SIGNAL_HPP
+#define COMP_SHARDED_SIGNAL_HPP
+
+#include <comp/config.hpp>
+#include <comp/concept/signal.hpp>
+#include <comp/concept/signal_concept_impl.hpp>
+#include <comp/wrap/thread.hpp>
+
+namespace comp
+{
+
+template <typename Signature>
+class ShardedSignal;
+
+/// The sharded signal template. Use this template for signals to which many threads connect and disconnect
+/// slots concurrently. The slots of the signal are spread over shards, each shard with its own lock, so the
+/// connects and disconnects of different shards do not contend on the same lock. The shard of a slot is
+/// picked by the address of the slot.
+///
+/// The emission walks the shards in order, taking one snapshot per shard. The slots of a shard are activated
+/// in priority and connection order, but the slots of the signal are not: the activation order follows the
+/// shards.
+/// \tparam ReturnType The return type of the signal.
+/// \tparam Arguments The arguments of the signal, which is the signature of the signal.
+template <typename ReturnType, typename... Arguments>
+class COMP_TEMPLATE_API ShardedSignal<ReturnType(Arguments...)> : public SignalConcept<ReturnType, Arguments...>
+{
+    using BaseClass = SignalConcept<ReturnType, Arguments...>;
+
+public:
+    /// Constructs the signal with \a shardCount shards.
+    /// \param shardCount The number of shards. The signal has at least one shard.
+    explicit ShardedSignal(size_t shardCount = getDefaultShardCount())
+        : BaseClass(shardCount)
+    {
+    }
+
+    /// Returns the number of shards of the signal.
+    size_t getShardCount() const
+    {
+        return BaseClass::getShardCount();
+    }
+
+    /// Returns the default number of shards, which is the number of hardware threads in thread-safe builds,
+    /// and one otherwise.
+    static size_t getDefaultShardCount()
+    {
+#ifdef COMP_CONFIG_THREAD_ENABLED
+        return thread::hardware_concurrency();
+#else
+        return 1u;
+#endif
+    }
+};
+
+} // namespace comp
+
+#endif // COMP_SHARDED_SIGNAL_HPP
@@ -43,13 +43,31 @@ public:
 
     /// Emit override for method signals.
     template <class Collector = DefaultSignalCollector<ReturnType>>
-    Collector operator()(Arguments... arguments)
+    Collector operator()(signal_argument_t<Arguments>... arguments)
     {
         auto lockedHost = m_host.shared_from_this();
         COMP_ASSERT(lockedHost);
-        auto collector = BaseClass::template operator()<Collector>(forward<Arguments>(arguments)...);
+        auto collector = BaseClass::template operator()<Collector>(forward<signal_argument_t<Arguments>>(arguments)...);
         return collector;
     }
+
+    /// Emit override for method signals, with a caller-owned \a collector.
+    template <class Collector>
+    Collector& emit(Collector& collector, signal_argument_t<Arguments>... arguments)
+    {
+        auto lockedHost = m_host.shared_from_this();
+        COMP_ASSERT(lockedHost);
+        return BaseClass::emit(collector, forward<signal_argument_t<Arguments>>(arguments)...);
+    }
+
+    /// Batch emit override for method signals.
+    template <class Collector = DefaultSignalCollector<ReturnType>>
+    Collector emitBatch(signal_batch_t<Arguments...> events)
+    {
+        auto lockedHost = m_host.shared_from_this();
+        COMP_ASSERT(lockedHost);
+        return BaseClass::template emitBatch<Collector>(events);
+    }
 };
 
 } // namespace comp
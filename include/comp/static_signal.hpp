@@ -0,0 +1,68 @@
+#ifndef COMP_STATIC_SIGNAL_HPP
+#define COMP_STATIC_SIGNAL_HPP
+
+#include <comp/config.hpp>
+#include <comp/concept/signal.hpp>
+#include <comp/concept/signal_concept_impl.hpp>
+#include <comp/wrap/type_traits.hpp>
+
+namespace comp
+{
+
+template <typename Signature, auto... Slots>
+class StaticSignal;
+
+/// The static signal template. Use this template to define a signal with a slot set known at compile time.
+/// The slots are function pointers, or, from C++20 on, captureless lambdas. The emission of the signal invokes
+/// the slots in the order they are declared, without any runtime container, lock or indirection, so the
+/// compiler can inline the slots.
+///
+/// The static signal uses the same collectors as the Signal. The connection passed to the collectors is
+/// empty. The static signal has no state: it cannot be blocked, and it does not protect against re-entrancy.
+/// \tparam ReturnType The return type of the signal.
+/// \tparam Arguments The arguments of the signal, which is the signature of the signal.
+/// \tparam Slots The slots of the signal.
+template <typename ReturnType, typename... Arguments, auto... Slots>
+class COMP_TEMPLATE_API StaticSignal<ReturnType(Arguments...), Slots...>
+{
+    static_assert((is_invocable_r_v<ReturnType, decltype(Slots), signal_argument_t<Arguments>...> && ...),
+                  "Incompatible slot signature");
+
+public:
+    /// Constructor.
+    explicit StaticSignal() = default;
+
+    /// Activates the signal with a specific \a Collector. Returns the collected results gathered from the
+    /// slots by the collector type.
+    /// \tparam Collector The collector used in emit.
+    /// \param arguments The arguments to pass. The slots share the arguments, see signal_argument_t.
+    template <class Collector = DefaultSignalCollector<ReturnType>>
+    Collector operator()(signal_argument_t<Arguments>... arguments) const
+    {
+        auto collector = Collector();
+        emit(collector, forward<signal_argument_t<Arguments>>(arguments)...);
+        return collector;
+    }
+
+    /// Activates the signal, and collects the results of the slots into a caller-owned \a collector.
+    /// \param collector The collector of the results.
+    /// \param arguments The arguments to pass. The slots share the arguments, see signal_argument_t.
+    /// \return The collector.
+    template <class Collector>
+    Collector& emit(Collector& collector, signal_argument_t<Arguments>... arguments) const
+    {
+        // The fold stops at the first slot for which the collector returns false.
+        static_cast<void>((collector.template collectCall<ReturnType>(Slots, forward<signal_argument_t<Arguments>>(arguments)...) && ...));
+        return collector;
+    }
+
+    /// Returns the number of slots of the signal.
+    static constexpr size_t size()
+    {
+        return sizeof...(Slots);
+    }
+};
+
+} // namespace comp
+
+#endif // COMP_STATIC_SIGNAL_HPP
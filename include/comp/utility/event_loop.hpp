@@ -0,0 +1,320 @@
+#ifndef COMP_EVENT_LOOP_HPP
+#define COMP_EVENT_LOOP_HPP
+
+#include <comp/config.hpp>
+#include <comp/utility/memory_pool.hpp>
+#include <comp/wrap/atomic.hpp>
+#include <comp/wrap/memory.hpp>
+#include <comp/wrap/mutex.hpp>
+#include <comp/wrap/utility.hpp>
+
+namespace comp
+{
+
+/// The EventLoop delivers the events posted from any thread on the thread that runs the loop. Signals use
+/// event loops to activate queued connections, where the slot runs on the thread of the loop instead of the
+/// thread that emits the signal.
+///
+/// The events are pushed to a lock-free queue, and the loop takes the queued events in batches. The blocks of the
+/// delivered events are recycled to the posters without locking. Run the loop with run(), or call processEvents()
+/// from your own loop. Call both from the same thread.
+/// \see SignalConcept::connect(EventLoop&, const FunctionType&)
+class COMP_API EventLoop
+{
+public:
+    /// The base of the events posted to the loop.
+    class COMP_API Event
+    {
+        friend class EventLoop;
+        Event* m_next = nullptr;
+        size_t m_size = 0u;
+
+    public:
+        /// Destructor.
+        virtual ~Event() = default;
+
+        /// Delivers the event. Called on the thread of the event loop.
+        virtual void dispatch() = 0;
+    };
+
+    /// The event queue of the loop. The queue is shared by the loop and the posters, and outlives the loop.
+    /// Once the loop is destroyed, the queue is closed, and refuses the events posted.
+    class COMP_API Queue
+    {
+        friend class EventLoop;
+
+    public:
+        /// Constructor.
+        explicit Queue() = default;
+
+        /// Destructor. Destroys the events that were not delivered.
+        ~Queue()
+        {
+            close();
+        }
+
+        /// Creates an event of \a EventType, and pushes the event to the queue. The event reuses the block of a
+        /// delivered event of the same size class without locking. Only when no such block is recycled, the
+        /// event is allocated from the memory pool of the queue.
+        /// \param arguments The arguments passed to the constructor of the event.
+        /// \return If the event is queued, returns \e true. If the queue is closed, returns \e false.
+        template <class EventType, class... Arguments>
+        bool post(Arguments&&... arguments)
+        {
+            static_assert(is_base_of_v<Event, EventType>, "Invalid event type");
+
+            auto block = allocate(sizeof(EventType));
+            Event* event = nullptr;
+            try
+            {
+                event = new (block) EventType(forward<Arguments>(arguments)...);
+            }
+            catch (...)
+            {
+                deallocate(block, sizeof(EventType));
+                throw;
+            }
+            event->m_size = sizeof(EventType);
+            return push(event);
+        }
+
+    private:
+        /// The size classes of the recycled blocks, the same as the size classes of the memory pool.
+        static constexpr size_t recycledClassCount = MemoryPool::maxBlockSize / MemoryPool::granularity;
+
+        struct FreeBlock
+        {
+            FreeBlock* next = nullptr;
+        };
+
+        static size_t getSizeClass(size_t size)
+        {
+            return (size + MemoryPool::granularity - 1u) / MemoryPool::granularity - 1u;
+        }
+
+        void* allocate(size_t size)
+        {
+            const auto sizeClass = getSizeClass(size);
+            if (sizeClass >= recycledClassCount)
+            {
+                return m_pool->allocate(size);
+            }
+
+            // Take all the recycled blocks of the size class, unlike popping a single block this is free of ABA.
+            // Keep the first block, and give back the rest.
+            auto& recycled = m_recycled[sizeClass];
+            auto block = recycled.exchange(nullptr, memory_order_acquire);
+            if (!block)
+            {
+                return m_pool->allocate(size);
+            }
+            if (auto rest = block->next)
+            {
+                auto head = static_cast<FreeBlock*>(nullptr);
+                if (!recycled.compare_exchange_strong(head, rest, memory_order_release, memory_order_relaxed))
+                {
+                    // Blocks got recycled meanwhile, append them to the rest.
+                    auto last = rest;
+                    while (last->next)
+                    {
+                        last = last->next;
+                    }
+                    recycle(recycled, rest, last);
+                }
+            }
+            block->~FreeBlock();
+            return block;
+        }
+
+        void deallocate(void* block, size_t size)
+        {
+            const auto sizeClass = getSizeClass(size);
+            if (sizeClass >= recycledClassCount)
+            {
+                m_pool->deallocate(block, size);
+                return;
+            }
+            auto freeBlock = new (block) FreeBlock;
+            recycle(m_recycled[sizeClass], freeBlock, freeBlock);
+        }
+
+        /// Pushes the blocks from \a first to \a last to the \a recycled blocks of a size class.
+        static void recycle(atomic<FreeBlock*>& recycled, FreeBlock* first, FreeBlock* last)
+        {
+            auto head = recycled.load(memory_order_relaxed);
+            do
+            {
+                last->next = head;
+            } while (!recycled.compare_exchange_weak(head, first, memory_order_release, memory_order_relaxed));
+        }
+
+        Event* closedTag()
+        {
+            // Marks the closed queue. The tag is never dereferenced.
+            return reinterpret_cast<Event*>(this);
+        }
+
+        bool push(Event* event)
+        {
+            auto head = m_head.load();
+            do
+            {
+                if (head == closedTag())
+                {
+                    destroy(event);
+                    return false;
+                }
+                event->m_next = head;
+            } while (!m_head.compare_exchange_weak(head, event));
+
+#ifdef COMP_CONFIG_THREAD_ENABLED
+            // The loop only sleeps on an empty queue. Wake the loop when it sleeps, and the queue was empty.
+            if (!head && m_isSleeping.load())
+            {
+                {
+                    lock_guard lock(m_sleepLock);
+                }
+                m_wakeUp.notify_one();
+            }
+#endif
+            return true;
+        }
+
+        /// Takes the queued events in the order they were posted.
+        Event* takeAll()
+        {
+            auto head = m_head.exchange(nullptr);
+
+            // The queue is last-in first-out, reverse the events.
+            Event* batch = nullptr;
+            while (head)
+            {
+                auto next = head->m_next;
+                head->m_next = batch;
+                batch = head;
+                head = next;
+            }
+            return batch;
+        }
+
+        void destroy(Event* event)
+        {
+            const auto size = event->m_size;
+            event->~Event();
+            deallocate(event, size);
+        }
+
+        void close()
+        {
+            auto head = m_head.exchange(closedTag());
+            while (head && head != closedTag())
+            {
+                destroy(exchange(head, head->m_next));
+            }
+        }
+
+        /// The pool of the event blocks. The pool releases the recycled blocks when the queue is destroyed.
+        intrusive_ptr<MemoryPool> m_pool = make_intrusive<MemoryPool>();
+        atomic<FreeBlock*> m_recycled[recycledClassCount] = {};
+        atomic<Event*> m_head = nullptr;
+#ifdef COMP_CONFIG_THREAD_ENABLED
+        mutex m_sleepLock;
+        condition_variable m_wakeUp;
+        atomic_bool m_isSleeping = false;
+        atomic_bool m_quit = false;
+#endif
+    };
+    using QueuePtr = shared_ptr<Queue>;
+
+    /// Constructor.
+    explicit EventLoop() = default;
+
+    /// Destructor. Closes the queue of the loop, and destroys the events that were not delivered.
+    ~EventLoop()
+    {
+        while (m_batch)
+        {
+            m_queue->destroy(exchange(m_batch, m_batch->m_next));
+        }
+        m_queue->close();
+    }
+
+    COMP_DISABLE_COPY_OR_MOVE(EventLoop)
+
+    /// Returns the queue of the loop.
+    QueuePtr getQueue() const
+    {
+        return m_queue;
+    }
+
+    /// Delivers the events queued by the time of the call. Events posted during the delivery are delivered
+    /// by the next call. If an event throws, the remaining events are delivered by the next call.
+    /// \return The number of delivered events.
+    size_t processEvents()
+    {
+        if (!m_batch)
+        {
+            m_batch = m_queue->takeAll();
+        }
+
+        auto count = size_t(0u);
+        while (m_batch)
+        {
+            auto event = exchange(m_batch, m_batch->m_next);
+            EventGuard guard{*m_queue, event};
+            event->dispatch();
+            ++count;
+        }
+        return count;
+    }
+
+#ifdef COMP_CONFIG_THREAD_ENABLED
+    /// Runs the loop on the calling thread until quit() is called. The loop sleeps while the queue is empty.
+    /// The events queued when the loop quits are delivered by the next run, or by processEvents().
+    void run()
+    {
+        while (!m_queue->m_quit.exchange(false))
+        {
+            if (processEvents() > 0u)
+            {
+                continue;
+            }
+
+            unique_lock lock(m_queue->m_sleepLock);
+            // Announce the sleep before checking the queue, so the posters either see the loop sleeping, or
+            // the loop sees the posted event.
+            m_queue->m_isSleeping = true;
+            m_queue->m_wakeUp.wait(lock, [this]() { return m_queue->m_quit.load() || m_queue->m_head.load(); });
+            m_queue->m_isSleeping = false;
+        }
+    }
+
+    /// Stops the loop started with run(). Call the method from any thread.
+    void quit()
+    {
+        {
+            lock_guard lock(m_queue->m_sleepLock);
+            m_queue->m_quit = true;
+        }
+        m_queue->m_wakeUp.notify_one();
+    }
+#endif
+
+private:
+    struct EventGuard
+    {
+        Queue& queue;
+        Event* event;
+        ~EventGuard()
+        {
+            queue.destroy(event);
+        }
+    };
+
+    QueuePtr m_queue = make_shared<Queue>();
+    Event* m_batch = nullptr;
+};
+
+} // namespace comp
+
+#endif // COMP_EVENT_LOOP_HPP
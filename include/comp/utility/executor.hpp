@@ -0,0 +1,31 @@
+#ifndef COMP_EXECUTOR_HPP
+#define COMP_EXECUTOR_HPP
+
+#include <comp/config.hpp>
+#include <comp/wrap/functional.hpp>
+
+namespace comp
+{
+
+/// The Executor is the interface of the task runners used with asynchronous signal emissions. Implement
+/// the interface to run the slot activations of an asynchronous emission on your own threads, or use the
+/// ThreadPool provided by the library.
+/// \see SignalConcept::emitAsync()
+class COMP_API Executor
+{
+public:
+    /// The task type run by the executor.
+    using Task = function<void()>;
+
+    /// Destructor.
+    virtual ~Executor() = default;
+
+    /// Runs a \a task. The executor may run the task on any thread, and in any order relative to other tasks.
+    /// The tasks passed by the signals do not throw.
+    /// \param task The task to run.
+    virtual void execute(Task task) = 0;
+};
+
+} // namespace comp
+
+#endif // COMP_EXECUTOR_HPP
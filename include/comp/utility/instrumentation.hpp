@@ -0,0 +1,247 @@
+#ifndef COMP_INSTRUMENTATION_HPP
+#define COMP_INSTRUMENTATION_HPP
+
+#include <comp/config.hpp>
+
+#ifdef COMP_CONFIG_INSTRUMENTATION_ENABLED
+
+#include <comp/wrap/array.hpp>
+#include <comp/wrap/atomic.hpp>
+#include <comp/wrap/chrono.hpp>
+#include <comp/wrap/memory.hpp>
+#include <comp/wrap/mutex.hpp>
+#include <comp/wrap/string.hpp>
+#include <comp/wrap/utility.hpp>
+#include <comp/wrap/vector.hpp>
+
+namespace comp
+{
+
+namespace core
+{
+class Signal;
+}
+
+/// The LatencyHistogram counts durations in buckets of exponentially growing size. The bucket at index \e i
+/// counts the durations from 2^i up to 2^(i+1) nanoseconds, the first bucket also counts the zero durations,
+/// and the last bucket counts all the durations that do not fit the other buckets. Recording a duration is a
+/// single relaxed atomic increment.
+class COMP_API LatencyHistogram
+{
+public:
+    /// The number of buckets of the histogram.
+    static constexpr size_t BucketCount = 32u;
+    /// The counts of the buckets.
+    using Buckets = array<size_t, BucketCount>;
+
+    /// Records a \a duration.
+    void record(chrono::nanoseconds duration)
+    {
+        m_buckets[getBucket(duration)].fetch_add(1u, memory_order_relaxed);
+    }
+
+    /// Returns the counts of the buckets. The counts are read one by one, without stopping the recorders.
+    Buckets getBuckets() const
+    {
+        auto buckets = Buckets();
+        for (auto index = 0u; index < BucketCount; ++index)
+        {
+            buckets[index] = m_buckets[index].load(memory_order_relaxed);
+        }
+        return buckets;
+    }
+
+    /// Returns the bucket index of a \a duration.
+    static size_t getBucket(chrono::nanoseconds duration)
+    {
+        auto index = size_t(0u);
+        for (auto value = duration.count(); value > 1 && index < BucketCount - 1u; value >>= 1)
+        {
+            ++index;
+        }
+        return index;
+    }
+
+private:
+    array<atomic<size_t>, BucketCount> m_buckets = {};
+};
+
+/// The SignalStatistics holds the counters of a signal. The counters are updated with relaxed atomic
+/// increments by the emitters, and are shared with the slots of the signal, so emissions that outlive the
+/// signal update valid counters.
+class COMP_API SignalStatistics
+{
+public:
+    /// The values of the counters of a signal.
+    struct Counters
+    {
+        /// The number of emissions. A batch emission counts an emission for each event of the batch.
+        size_t emitCount = 0u;
+        /// The number of slot activations.
+        size_t activationCount = 0u;
+        /// The number of emissions dropped because the signal was blocked.
+        size_t blockedCount = 0u;
+        /// The number of emissions dropped because the signal was emitted from one of its slots.
+        size_t reentrantCount = 0u;
+        /// The number of slots disconnected by the emissions, because their trackers or receivers were destroyed.
+        size_t autoDisconnectCount = 0u;
+    };
+
+    /// Returns the values of the counters. The counters are read one by one, without stopping the emitters.
+    Counters getCounters() const
+    {
+        auto counters = Counters();
+        counters.emitCount = m_emitCount.load(memory_order_relaxed);
+        counters.activationCount = m_activationCount.load(memory_order_relaxed);
+        counters.blockedCount = m_blockedCount.load(memory_order_relaxed);
+        counters.reentrantCount = m_reentrantCount.load(memory_order_relaxed);
+        counters.autoDisconnectCount = m_autoDisconnectCount.load(memory_order_relaxed);
+        return counters;
+    }
+
+    void countEmit(size_t count = 1u)
+    {
+        m_emitCount.fetch_add(count, memory_order_relaxed);
+    }
+    void countActivation(size_t count = 1u)
+    {
+        m_activationCount.fetch_add(count, memory_order_relaxed);
+    }
+    void countBlocked()
+    {
+        m_blockedCount.fetch_add(1u, memory_order_relaxed);
+    }
+    void countReentrant()
+    {
+        m_reentrantCount.fetch_add(1u, memory_order_relaxed);
+    }
+    void countAutoDisconnect()
+    {
+        m_autoDisconnectCount.fetch_add(1u, memory_order_relaxed);
+    }
+
+private:
+    atomic<size_t> m_emitCount = 0u;
+    atomic<size_t> m_activationCount = 0u;
+    atomic<size_t> m_blockedCount = 0u;
+    atomic<size_t> m_reentrantCount = 0u;
+    atomic<size_t> m_autoDisconnectCount = 0u;
+};
+using SignalStatisticsPtr = shared_ptr<SignalStatistics>;
+
+/// The statistics of a signal, taken by a snapshot of the StatisticsRegistry.
+struct SignalSnapshot
+{
+    /// The signal, used only to identify the signal. The signal may be destroyed since the snapshot.
+    const core::Signal* signal = nullptr;
+    /// The name of the signal.
+    string name;
+    /// The counters of the signal.
+    SignalStatistics::Counters counters;
+    /// The activation time histograms of the slots connected to the signal, in connection order.
+    vector<LatencyHistogram::Buckets> slotActivationTimes;
+};
+
+/// The StatisticsRegistry holds the signals alive in the application. Take snapshots of the statistics of
+/// the signals with snapshot(), from any thread. The snapshot does not stop the emitters: the counters are
+/// read atomically, and the slots of a signal are read from the same immutable snapshot the emitters use.
+/// Signals register themselves on construction, and unregister on destruction.
+class COMP_API StatisticsRegistry
+{
+public:
+    /// The entry of a signal in the registry. The entry is held by the signal.
+    class COMP_API Entry
+    {
+        friend class StatisticsRegistry;
+
+    public:
+        /// The function that collects the activation time histograms of the slots of a signal.
+        using CollectSlotsFunction = void(*)(core::Signal&, vector<LatencyHistogram::Buckets>&);
+
+        /// Registers the \a signal with the function that collects the statistics of its slots.
+        explicit Entry(core::Signal& signal, SignalStatisticsPtr statistics, CollectSlotsFunction collectSlots)
+            : m_signal(signal)
+            , m_statistics(move(statistics))
+            , m_collectSlots(collectSlots)
+        {
+            StatisticsRegistry::get().add(*this);
+        }
+
+        /// Unregisters the signal.
+        ~Entry()
+        {
+            StatisticsRegistry::get().remove(*this);
+        }
+
+        COMP_DISABLE_COPY_OR_MOVE(Entry)
+
+        /// Sets the \a name of the signal reported in the snapshots.
+        void setName(const string& name)
+        {
+            auto& registry = StatisticsRegistry::get();
+            lock_guard lock(registry.m_lock);
+            m_name = name;
+        }
+
+    private:
+        core::Signal& m_signal;
+        SignalStatisticsPtr m_statistics;
+        CollectSlotsFunction m_collectSlots = nullptr;
+        string m_name;
+        Entry* m_previous = nullptr;
+        Entry* m_next = nullptr;
+    };
+
+    /// Returns the registry of the application.
+    static StatisticsRegistry& get()
+    {
+        static StatisticsRegistry registry;
+        return registry;
+    }
+
+    /// Takes the snapshot of the statistics of the registered signals. Signals are neither created nor
+    /// destroyed while the snapshot is taken.
+    /// \return The statistics of the registered signals, in registration order.
+    vector<SignalSnapshot> snapshot()
+    {
+        lock_guard lock(m_lock);
+        vector<SignalSnapshot> result;
+        for (auto entry = m_first; entry; entry = entry->m_next)
+        {
+            auto& signal = result.emplace_back();
+            signal.signal = &entry->m_signal;
+            signal.name = entry->m_name;
+            signal.counters = entry->m_statistics->getCounters();
+            entry->m_collectSlots(entry->m_signal, signal.slotActivationTimes);
+        }
+        return result;
+    }
+
+private:
+    explicit StatisticsRegistry() = default;
+
+    void add(Entry& entry)
+    {
+        lock_guard lock(m_lock);
+        entry.m_previous = m_last;
+        (m_last ? m_last->m_next : m_first) = &entry;
+        m_last = &entry;
+    }
+
+    void remove(Entry& entry)
+    {
+        lock_guard lock(m_lock);
+        (entry.m_previous ? entry.m_previous->m_next : m_first) = entry.m_next;
+        (entry.m_next ? entry.m_next->m_previous : m_last) = entry.m_previous;
+    }
+
+    mutex m_lock;
+    Entry* m_first = nullptr;
+    Entry* m_last = nullptr;
+};
+
+} // namespace comp
+
+#endif
+
+#endif // COMP_INSTRUMENTATION_HPP
@@ -0,0 +1,113 @@
+#ifndef COMP_MEMORY_POOL_HPP
+#define COMP_MEMORY_POOL_HPP
+
+#include <comp/config.hpp>
+#include <comp/utility/lockable.hpp>
+#include <comp/wrap/memory.hpp>
+#include <comp/wrap/mutex.hpp>
+#include <comp/wrap/vector.hpp>
+
+namespace comp
+{
+
+/// The MemoryPool is a memory resource that recycles fixed size blocks. The blocks are grouped in size classes,
+/// and each size class is refilled from slabs holding multiple blocks. Released blocks are kept in the pool
+/// and reused by the next allocation of the same size class, without touching the global heap. Blocks larger
+/// than #maxBlockSize are allocated from the global heap.
+///
+/// Use the pool with a signal to allocate the slots and the trackers of that signal from the pool. You can share
+/// the same pool between signals, or create a pool for each thread to avoid lock contention.
+/// \see SignalConcept::setMemoryResource()
+class COMP_API MemoryPool : public MemoryResource, public Lockable<mutex>
+{
+public:
+    /// The granularity of the size classes.
+    static constexpr size_t granularity = alignof(max_align_t);
+    /// The largest block size served by the pool.
+    static constexpr size_t maxBlockSize = 512u;
+    /// The number of blocks allocated for a size class when the size class runs out of blocks.
+    static constexpr size_t blocksPerSlab = 32u;
+
+    /// Constructor.
+    explicit MemoryPool() = default;
+
+    /// Destructor. Releases the slabs of the pool.
+    ~MemoryPool()
+    {
+        for (auto slab : m_slabs)
+        {
+            ::operator delete(slab);
+        }
+    }
+
+    /// Allocates a block of \a size from the pool.
+    void* allocate(size_t size) override
+    {
+        const auto sizeClass = getSizeClass(size);
+        if (sizeClass >= sizeClassCount)
+        {
+            return ::operator new(size);
+        }
+
+        lock_guard lock(*this);
+        auto& freeList = m_freeLists[sizeClass];
+        if (!freeList)
+        {
+            refill(sizeClass);
+        }
+        auto block = freeList;
+        freeList = block->next;
+        return block;
+    }
+
+    /// Releases a \a block of \a size to the pool.
+    void deallocate(void* block, size_t size) override
+    {
+        const auto sizeClass = getSizeClass(size);
+        if (sizeClass >= sizeClassCount)
+        {
+            ::operator delete(block);
+            return;
+        }
+
+        lock_guard lock(*this);
+        auto freeBlock = static_cast<FreeBlock*>(block);
+        freeBlock->next = m_freeLists[sizeClass];
+        m_freeLists[sizeClass] = freeBlock;
+    }
+
+private:
+    static constexpr size_t sizeClassCount = maxBlockSize / granularity;
+
+    struct FreeBlock
+    {
+        FreeBlock* next = nullptr;
+    };
+
+    static size_t getSizeClass(size_t size)
+    {
+        return (size + granularity - 1u) / granularity - 1u;
+    }
+
+    void refill(size_t sizeClass)
+    {
+        const auto blockSize = (sizeClass + 1u) * granularity;
+        m_slabs.push_back(nullptr);
+        auto slab = static_cast<char*>(::operator new(blockSize * blocksPerSlab));
+        m_slabs.back() = slab;
+
+        for (auto i = blocksPerSlab; i > 0u; --i)
+        {
+            auto freeBlock = new (slab + (i - 1u) * blockSize) FreeBlock;
+            freeBlock->next = m_freeLists[sizeClass];
+            m_freeLists[sizeClass] = freeBlock;
+        }
+    }
+
+    FreeBlock* m_freeLists[sizeClassCount] = {};
+    vector<void*> m_slabs;
+};
+
+} // namespace comp
+
+#endif // COMP_MEMORY_POOL_HPP
@@ -0,0 +1,174 @@
+#ifndef COMP_THREAD_POOL_HPP
+#define COMP_THREAD_POOL_HPP
+
+#include <comp/config.hpp>
+
+#ifdef COMP_CONFIG_THREAD_ENABLED
+
+#include <comp/utility/executor.hpp>
+#include <comp/wrap/algorithm.hpp>
+#include <comp/wrap/atomic.hpp>
+#include <comp/wrap/deque.hpp>
+#include <comp/wrap/memory.hpp>
+#include <comp/wrap/mutex.hpp>
+#include <comp/wrap/thread.hpp>
+#include <comp/wrap/utility.hpp>
+#include <comp/wrap/vector.hpp>
+
+namespace comp
+{
+
+/// The ThreadPool is a work-stealing executor. Each worker thread of the pool owns a task queue. A task
+/// submitted from a worker thread is queued to the queue of that worker, and the worker runs its own tasks
+/// in last-in first-out order. Tasks submitted from other threads are distributed between the workers. An idle
+/// worker steals the oldest task of the other workers before going to sleep.
+///
+/// The destructor of the pool runs the pending tasks, then joins the worker threads.
+class COMP_API ThreadPool : public Executor
+{
+public:
+    /// Constructs the thread pool with \a threadCount worker threads. The pool has at least one worker thread.
+    explicit ThreadPool(size_t threadCount = thread::hardware_concurrency())
+    {
+        threadCount = max(threadCount, size_t(1u));
+        for (auto i = 0u; i < threadCount; ++i)
+        {
+            m_workers.push_back(make_unique<Worker>());
+        }
+        for (auto i = 0u; i < threadCount; ++i)
+        {
+            m_threads.emplace_back(&ThreadPool::run, this, i);
+        }
+    }
+
+    /// Destructor. Runs the pending tasks, and joins the worker threads.
+    ~ThreadPool()
+    {
+        {
+            lock_guard lock(m_sleepLock);
+            m_stop = true;
+        }
+        m_wakeUp.notify_all();
+        for (auto& thread : m_threads)
+        {
+            thread.join();
+        }
+    }
+
+    /// Returns the number of worker threads of the pool.
+    size_t size() const
+    {
+        return m_workers.size();
+    }
+
+    /// Queues a \a task to run on one of the worker threads.
+    void execute(Task task) override
+    {
+        // Count the task before queueing, so a worker that looks for tasks does not go to sleep while the task
+        // is being queued.
+        m_pendingCount.fetch_add(1u);
+
+        const auto index = (current == this) ? currentIndex : m_nextWorker.fetch_add(1u) % m_workers.size();
+        {
+            auto& worker = *m_workers[index];
+            lock_guard lock(worker.lock);
+            worker.tasks.push_back(move(task));
+        }
+
+        // Wake a worker only if there is a sleeping one. A worker going to sleep registers itself before it
+        // checks the pending tasks, so either the worker sees the task, or this thread sees the worker. Take
+        // the sleep lock to not notify between the check and the wait of that worker.
+        if (m_sleepingCount.load() > 0u)
+        {
+            {
+                lock_guard lock(m_sleepLock);
+            }
+            m_wakeUp.notify_one();
+        }
+    }
+
+private:
+    struct Worker
+    {
+        mutex lock;
+        deque<Task> tasks;
+    };
+
+    /// Takes the newest task of the worker at \a index.
+    bool pop(size_t index, Task& task)
+    {
+        auto& worker = *m_workers[index];
+        lock_guard lock(worker.lock);
+        if (worker.tasks.empty())
+        {
+            return false;
+        }
+        task = move(worker.tasks.back());
+        worker.tasks.pop_back();
+        return true;
+    }
+
+    /// Takes the oldest task of a worker other than the worker at \a index.
+    bool steal(size_t index, Task& task)
+    {
+        for (auto i = 1u; i < m_workers.size(); ++i)
+        {
+            auto& victim = *m_workers[(index + i) % m_workers.size()];
+            lock_guard lock(victim.lock);
+            if (!victim.tasks.empty())
+            {
+                task = move(victim.tasks.front());
+                victim.tasks.pop_front();
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /// The loop of the worker thread at \a index.
+    void run(size_t index)
+    {
+        current = this;
+        currentIndex = index;
+
+        while (true)
+        {
+            Task task;
+            if (pop(index, task) || steal(index, task))
+            {
+                m_pendingCount.fetch_sub(1u);
+                task();
+                continue;
+            }
+
+            unique_lock lock(m_sleepLock);
+            m_sleepingCount.fetch_add(1u);
+            m_wakeUp.wait(lock, [this]() { return m_stop || m_pendingCount.load() > 0u; });
+            m_sleepingCount.fetch_sub(1u);
+            if (m_stop && m_pendingCount.load() == 0u)
+            {
+                break;
+            }
+        }
+
+        current = nullptr;
+    }
+
+    static inline thread_local ThreadPool* current = nullptr;
+    static inline thread_local size_t currentIndex = 0u;
+
+    vector<unique_ptr<Worker>> m_workers;
+    vector<thread> m_threads;
+    mutex m_sleepLock;
+    condition_variable m_wakeUp;
+    atomic<size_t> m_pendingCount = 0u;
+    atomic<size_t> m_nextWorker = 0u;
+    atomic<size_t> m_sleepingCount = 0u;
+    bool m_stop = false;
+};
+
+} // namespace comp
+
+#endif
+
+#endif // COMP_THREAD_POOL_HPP
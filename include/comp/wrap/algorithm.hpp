@@ -9,9 +9,11 @@ namespace comp
 using std::for_each;
 using std::find;
 using std::find_if;
+using std::max;
 using std::remove;
 using std::remove_if;
 using std::swap;
+using std::upper_bound;
 
 } // namespace comp
 
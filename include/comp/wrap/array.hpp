@@ -0,0 +1,13 @@
+#ifndef COMP_ARRAY_HPP
+#define COMP_ARRAY_HPP
+
+#include <array>
+
+namespace comp
+{
+
+using std::array;
+
+} // namespace comp
+
+#endif // COMP_ARRAY_HPP
@@ -9,6 +9,11 @@ namespace comp
 using std::atomic;
 using std::atomic_bool;
 using std::atomic_int;
+using std::atomic_thread_fence;
+using std::memory_order_acq_rel;
+using std::memory_order_acquire;
+using std::memory_order_relaxed;
+using std::memory_order_release;
 
 } // namespace comp
 
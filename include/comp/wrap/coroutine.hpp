@@ -0,0 +1,21 @@
+#ifndef COMP_WRAP_COROUTINE_HPP
+#define COMP_WRAP_COROUTINE_HPP
+
+#include <comp/config.hpp>
+
+#ifdef COMP_CONFIG_COROUTINES_ENABLED
+
+#include <coroutine>
+
+namespace comp
+{
+
+using std::coroutine_handle;
+using std::suspend_always;
+using std::suspend_never;
+
+} // namespace comp
+
+#endif
+
+#endif // COMP_WRAP_COROUTINE_HPP
@@ -8,6 +8,8 @@ namespace comp
 {
 
 using std::exception;
+using std::exception_ptr;
+using std::current_exception;
 using std::terminate;
 
 /// Exception thrown when a slot that is not connected is activated.
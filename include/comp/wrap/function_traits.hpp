@@ -34,6 +34,8 @@ struct function_traits<TRet(TObject::*)(Args...)>
     using return_type = TRet;
     typedef TRet(TObject::*function_type)(Args...);
 
+    using arguments = tuple<Args...>;
+
     static constexpr std::size_t arity = sizeof... (Args);
     static constexpr bool is_const = false;
     static constexpr int type = FunctionType::Method;
@@ -57,6 +59,8 @@ struct function_traits<TRet(TObject::*)(Args...) const>
     using return_type = TRet;
     typedef TRet(TObject::*function_type)(Args...) const;
 
+    using arguments = tuple<Args...>;
+
     static constexpr std::size_t arity = sizeof... (Args);
     static constexpr bool is_const = true;
     static constexpr int type = FunctionType::Method;
@@ -79,6 +83,8 @@ struct function_traits<TRet(*)(Args...)>
     using return_type = TRet;
     typedef TRet(*function_type)(Args...);
 
+    using arguments = tuple<Args...>;
+
     static constexpr std::size_t arity = sizeof... (Args);
     static constexpr bool is_const = false;
     static constexpr int type = FunctionType::Function;
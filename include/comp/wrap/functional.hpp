@@ -6,6 +6,7 @@
 namespace comp
 {
 
+using std::function;
 using std::invoke;
 using std::ref;
 using std::cref;
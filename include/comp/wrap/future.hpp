@@ -0,0 +1,20 @@
+#ifndef COMP_FUTURE_HPP
+#define COMP_FUTURE_HPP
+
+#include <comp/config.hpp>
+
+#ifdef COMP_CONFIG_THREAD_ENABLED
+
+#include <future>
+
+namespace comp
+{
+
+using std::future;
+using std::promise;
+
+} // namespace comp
+
+#endif
+
+#endif // COMP_FUTURE_HPP
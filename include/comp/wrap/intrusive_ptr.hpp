@@ -50,6 +50,16 @@ public:
         }
     }
 
+    template<class U>
+    intrusive_ptr(const intrusive_ptr<U>& rhs)
+        : m_ptr(rhs.get())
+    {
+        if (m_ptr)
+        {
+            intrusive_ptr_add_ref(m_ptr);
+        }
+    }
+
     intrusive_ptr(intrusive_ptr&& rhs)
     {
         swap(rhs);
@@ -1,13 +1,20 @@
 #ifndef COMP_MEMORY_HPP
 #define COMP_MEMORY_HPP
 
+#include <cstddef>
 #include <memory>
+#include <new>
+#include <comp/config.hpp>
+#include <comp/wrap/intrusive_ptr.hpp>
 #include <comp/wrap/utility.hpp>
 #include <comp/wrap/type_traits.hpp>
 
 namespace comp
 {
 
+using std::max_align_t;
+using std::size_t;
+
 using std::pointer_traits;
 
 using std::unique_ptr;
@@ -70,13 +77,61 @@ constexpr bool has_shared_from_this_v = has_shared_from_this<T>::value;
 
 /// \}
 
-/// std::make_shared initiates lots of control templates, creates loads of control blocks and deleters,
-/// which all increase the code size. This template offers smaller code size.
-template <class Base, class Derived, class... Arguments>
-shared_ptr<Base> make_shared(Arguments&&... args)
+/// The interface of the memory resources used to allocate the shared objects of the library, such as slots
+/// and trackers. Memory resources are reference counted, and each block allocated from a resource keeps
+/// the resource alive.
+class COMP_API MemoryResource : public enable_intrusive_ptr
+{
+public:
+    /// Destructor.
+    virtual ~MemoryResource() = default;
+
+    /// Allocates a block of memory.
+    /// \param size The size of the block, aligned to max_align_t.
+    /// \return The allocated block.
+    virtual void* allocate(size_t size) = 0;
+
+    /// Releases a \a block of memory allocated by this resource.
+    /// \param block The block to release.
+    /// \param size The size of the block.
+    virtual void deallocate(void* block, size_t size) = 0;
+};
+using MemoryResourcePtr = intrusive_ptr<MemoryResource>;
+
+namespace
+{
+
+/// The block functions of the objects allocated from a memory resource, or from the global heap.
+struct SharedBlock
 {
-    return shared_ptr<Base>(static_cast<Base*>(new Derived(forward<Arguments>(args)...)));
-}
+    /// Returns the \a size rounded up to the alignment of max_align_t. This is the offset of an object that
+    /// follows an object of \a size in a block.
+    static constexpr size_t alignedSize(size_t size)
+    {
+        return (size + alignof(max_align_t) - 1u) / alignof(max_align_t) * alignof(max_align_t);
+    }
+
+    /// Allocates a block of \a size from a \a resource, or from the global heap if the resource is \e nullptr.
+    static void* allocate(MemoryResource* resource, size_t size)
+    {
+        return resource ? resource->allocate(size) : ::operator new(size);
+    }
+
+    /// Releases a \a block of \a size to the \a resource the block was allocated from.
+    static void deallocate(MemoryResource* resource, void* block, size_t size)
+    {
+        if (resource)
+        {
+            resource->deallocate(block, size);
+        }
+        else
+        {
+            ::operator delete(block);
+        }
+    }
+};
+
+} // noname
 
 } // namespace comp
 
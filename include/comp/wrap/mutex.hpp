@@ -7,6 +7,7 @@
 
 #ifdef COMP_CONFIG_THREAD_ENABLED
 
+#include <condition_variable>
 #include <mutex>
 
 #endif
@@ -18,6 +19,8 @@ namespace comp
 
 using std::mutex;
 using std::lock_guard;
+using std::unique_lock;
+using std::condition_variable;
 
 #else
 
@@ -0,0 +1,14 @@
+#ifndef COMP_OPTIONAL_HPP
+#define COMP_OPTIONAL_HPP
+
+#include <optional>
+
+namespace comp
+{
+
+using std::optional;
+using std::nullopt;
+
+} // namespace comp
+
+#endif // COMP_OPTIONAL_HPP
@@ -0,0 +1,93 @@
+#ifndef COMP_SPAN_HPP
+#define COMP_SPAN_HPP
+
+#include <comp/config.hpp>
+
+#if __cplusplus >= 202002L && __has_include(<span>)
+#include <span>
+#endif
+
+#include <comp/wrap/type_traits.hpp>
+
+namespace comp
+{
+
+#if defined(__cpp_lib_span)
+
+using std::span;
+
+#else
+
+/// A minimal replacement of std::span for C++17. The span is a view of a contiguous sequence of
+/// elements, and does not own the elements.
+template <typename T>
+class COMP_TEMPLATE_API span
+{
+public:
+    using element_type = T;
+    using value_type = remove_cv_t<T>;
+    using pointer = T*;
+    using reference = T&;
+    using iterator = T*;
+
+    /// Constructs an empty span.
+    constexpr span() = default;
+
+    /// Constructs the span of \a size elements starting at \a data.
+    constexpr span(pointer data, size_t size)
+        : m_data(data)
+        , m_size(size)
+    {
+    }
+
+    /// Constructs the span of an array.
+    template <size_t N>
+    constexpr span(element_type (&array)[N])
+        : m_data(array)
+        , m_size(N)
+    {
+    }
+
+    /// Constructs the span of a contiguous \a container, such as a vector.
+    template <class Container, typename = enable_if_t<is_convertible_v<decltype(declval<Container&>().data()), pointer>>>
+    constexpr span(Container&& container)
+        : m_data(container.data())
+        , m_size(container.size())
+    {
+    }
+
+    constexpr pointer data() const
+    {
+        return m_data;
+    }
+    constexpr size_t size() const
+    {
+        return m_size;
+    }
+    constexpr bool empty() const
+    {
+        return m_size == 0u;
+    }
+    constexpr reference operator[](size_t index) const
+    {
+        return m_data[index];
+    }
+    constexpr iterator begin() const
+    {
+        return m_data;
+    }
+    constexpr iterator end() const
+    {
+        return m_data + m_size;
+    }
+
+private:
+    pointer m_data = nullptr;
+    size_t m_size = 0u;
+};
+
+#endif
+
+} // namespace comp
+
+#endif // COMP_SPAN_HPP
@@ -0,0 +1,13 @@
+#ifndef COMP_STRING_HPP
+#define COMP_STRING_HPP
+
+#include <string>
+
+namespace comp
+{
+
+using std::string;
+
+} // namespace comp
+
+#endif // COMP_STRING_HPP
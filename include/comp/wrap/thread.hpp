@@ -0,0 +1,20 @@
+#ifndef COMP_THREAD_HPP
+#define COMP_THREAD_HPP
+
+#include <comp/config.hpp>
+
+#ifdef COMP_CONFIG_THREAD_ENABLED
+
+#include <thread>
+
+namespace comp
+{
+
+using std::thread;
+namespace this_thread = std::this_thread;
+
+} // namespace comp
+
+#endif
+
+#endif // COMP_THREAD_HPP
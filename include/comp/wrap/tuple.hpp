@@ -1,15 +1,16 @@
 #ifndef COMP_TUPLE_HPP
 #define COMP_TUPLE_HPP
 
+#include <tuple>
+
 namespace comp
 {
 
-#include <tuple>
-
 using std::tuple;
 using std::make_tuple;
 using std::tuple_element;
 using std::get;
+using std::apply;
 
 } // namespace comp
 
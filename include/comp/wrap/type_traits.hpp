@@ -8,6 +8,7 @@ namespace comp
 
 using std::false_type;
 using std::true_type;
+using std::bool_constant;
 using std::declval;
 using std::decay;
 using std::decay_t;
@@ -17,19 +18,26 @@ using std::is_same;
 using std::is_same_v;
 using std::is_base_of;
 using std::is_base_of_v;
+using std::is_convertible;
+using std::is_convertible_v;
 using std::void_t;
 using std::is_void;
 using std::is_void_v;
 using std::remove_const_t;
+using std::remove_cv_t;
 using std::remove_reference_t;
 using std::is_member_function_pointer;
 using std::is_member_function_pointer_v;
 using std::is_pointer;
 using std::is_pointer_v;
+using std::is_reference;
+using std::is_reference_v;
 using std::remove_pointer;
 using std::remove_pointer_t;
 using std::conditional;
 using std::conditional_t;
+using std::is_invocable_r;
+using std::is_invocable_r_v;
 
 } // namespace traits
 
@@ -1,6 +1,7 @@
 #ifndef COMP_UTILITY_HPP
 #define COMP_UTILITY_HPP
 
+#include <cstdint>
 #include <utility>
 
 namespace comp
@@ -9,6 +10,10 @@ namespace comp
 using std::forward;
 using std::move;
 using std::exchange;
+using std::index_sequence;
+using std::index_sequence_for;
+using std::uint32_t;
+using std::uintptr_t;
 
 /// Template function to call a function \a f on an rgument pack. The function is expected to take a single
 /// argument.
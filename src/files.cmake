@@ -1,26 +1,45 @@
 set(HEADERS
     #SSIG
     ${CMAKE_CURRENT_SOURCE_DIR}/../include/comp/wrap/algorithm.hpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/../include/comp/wrap/array.hpp
     ${CMAKE_CURRENT_SOURCE_DIR}/../include/comp/wrap/atomic.hpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/../include/comp/wrap/chrono.hpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/../include/comp/wrap/coroutine.hpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/../include/comp/wrap/deque.hpp
     ${CMAKE_CURRENT_SOURCE_DIR}/../include/comp/wrap/exception.hpp
     ${CMAKE_CURRENT_SOURCE_DIR}/../include/comp/wrap/function_traits.hpp
     ${CMAKE_CURRENT_SOURCE_DIR}/../include/comp/wrap/functional.hpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/../include/comp/wrap/future.hpp
     ${CMAKE_CURRENT_SOURCE_DIR}/../include/comp/wrap/intrusive_ptr.hpp
     ${CMAKE_CURRENT_SOURCE_DIR}/../include/comp/wrap/memory.hpp
     ${CMAKE_CURRENT_SOURCE_DIR}/../include/comp/wrap/mutex.hpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/../include/comp/wrap/optional.hpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/../include/comp/wrap/span.hpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/../include/comp/wrap/string.hpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/../include/comp/wrap/thread.hpp
     ${CMAKE_CURRENT_SOURCE_DIR}/../include/comp/wrap/tuple.hpp
     ${CMAKE_CURRENT_SOURCE_DIR}/../include/comp/wrap/type_traits.hpp
     ${CMAKE_CURRENT_SOURCE_DIR}/../include/comp/wrap/utility.hpp
     ${CMAKE_CURRENT_SOURCE_DIR}/../include/comp/wrap/vector.hpp
 
+    ${CMAKE_CURRENT_SOURCE_DIR}/../include/comp/utility/event_loop.hpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/../include/comp/utility/executor.hpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/../include/comp/utility/instrumentation.hpp
     ${CMAKE_CURRENT_SOURCE_DIR}/../include/comp/utility/lockable.hpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/../include/comp/utility/memory_pool.hpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/../include/comp/utility/thread_pool.hpp
     ${CMAKE_CURRENT_SOURCE_DIR}/../include/comp/utility/tracker.hpp
 
     ${CMAKE_CURRENT_SOURCE_DIR}/../include/comp/concept/core/signal.hpp
 
     ${CMAKE_CURRENT_SOURCE_DIR}/../include/comp/concept/signal.hpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/../include/comp/concept/slot_store.hpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/../include/comp/collectors.hpp
     ${CMAKE_CURRENT_SOURCE_DIR}/../include/comp/config.hpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/../include/comp/coroutine.hpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/../include/comp/sharded_signal.hpp
     ${CMAKE_CURRENT_SOURCE_DIR}/../include/comp/signal.hpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/../include/comp/static_signal.hpp
     )
 
 set(PRIVATE_HEADERS
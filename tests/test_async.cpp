@@ -0,0 +1,175 @@
+#include "test_base.hpp"
+#include <comp/signal.hpp>
+
+#ifdef COMP_CONFIG_THREAD_ENABLED
+
+#include <comp/utility/thread_pool.hpp>
+#include <chrono>
+#include <stdexcept>
+#include <thread>
+
+namespace
+{
+
+/// Runs the tasks on the calling thread.
+class InlineExecutor : public comp::Executor
+{
+public:
+    void execute(Task task) override
+    {
+        ++taskCount;
+        task();
+    }
+    size_t taskCount = 0u;
+};
+
+}
+
+class AsyncSignalTest : public SignalTest
+{
+public:
+    comp::ThreadPool pool{4u};
+};
+
+// The thread pool runs the tasks queued from the worker threads and from other threads.
+TEST_F(AsyncSignalTest, threadPoolRunsTasks)
+{
+    std::atomic_int count = 0;
+    {
+        comp::ThreadPool threadPool(2u);
+        EXPECT_EQ(2u, threadPool.size());
+        for (auto i = 0; i < 100; ++i)
+        {
+            threadPool.execute([&threadPool, &count]()
+            {
+                ++count;
+                threadPool.execute([&count]() { ++count; });
+            });
+        }
+    }
+    EXPECT_EQ(200, count);
+}
+
+// The application developer can emit a signal asynchronously, and collect the results in connection order.
+TEST_F(AsyncSignalTest, emitAsync)
+{
+    comp::Signal<int(int)> signal;
+    signal.connect([](int value) { std::this_thread::sleep_for(std::chrono::milliseconds(20)); return value; });
+    signal.connect([](int value) { return value * 2; });
+    signal.connect([](int value) { return value * 3; });
+
+    auto future = signal.emitAsync(pool, 5);
+    const auto result = future.get();
+    EXPECT_EQ((std::vector<int>{5, 10, 15}), static_cast<const std::vector<int>&>(result));
+}
+
+// The slots of an asynchronous emission run in parallel.
+TEST_F(AsyncSignalTest, emitAsyncRunsSlotsInParallel)
+{
+    constexpr int slotCount = 4;
+    comp::Signal<void()> signal;
+    std::atomic_int enterCount = 0;
+    std::atomic_int parallelCount = 0;
+
+    auto slot = [&enterCount, &parallelCount]()
+    {
+        ++enterCount;
+        // Wait for the other slots to enter.
+        const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+        while (enterCount < slotCount && std::chrono::steady_clock::now() < deadline)
+        {
+            std::this_thread::yield();
+        }
+        parallelCount = enterCount.load();
+    };
+    for (auto i = 0; i < slotCount; ++i)
+    {
+        signal.connect(slot);
+    }
+
+    EXPECT_EQ(size_t(slotCount), signal.emitAsync(pool).get().size());
+    EXPECT_EQ(slotCount, parallelCount);
+}
+
+// The application developer can use a custom executor with the asynchronous emission.
+TEST_F(AsyncSignalTest, emitAsyncWithCustomExecutor)
+{
+    InlineExecutor executor;
+    comp::Signal<void(int)> signal;
+    signal.connect(&SignalTest::functionWithIntArgument);
+    auto connection = signal.connect([](int) { ++functionCallCount; });
+    connection.disconnect();
+
+    auto future = signal.emitAsync(executor, 7);
+    EXPECT_EQ(1u, future.get().size());
+    EXPECT_EQ(1u, executor.taskCount);
+    EXPECT_EQ(7u, intValue);
+    EXPECT_EQ(0u, functionCallCount);
+}
+
+// The collector of an asynchronous emission breaks the collecting, but not the activation of the slots.
+TEST_F(AsyncSignalTest, emitAsyncCollectorBreaks)
+{
+    comp::Signal<int()> signal;
+    signal.connect([]() { ++functionCallCount; return 1; });
+    signal.connect([]() { ++functionCallCount; return 2; });
+
+    auto result = signal.emitAsync<FirstOnly>(pool).get();
+    EXPECT_EQ(std::vector<int>{1}, result.results);
+    EXPECT_EQ(2u, functionCallCount);
+}
+
+// The exception thrown by a slot is passed to the future of the asynchronous emission.
+TEST_F(AsyncSignalTest, emitAsyncPassesException)
+{
+    comp::Signal<void()> signal;
+    signal.connect(&SignalTest::function);
+    signal.connect([]() { throw std::runtime_error("slot failed"); });
+
+    auto future = signal.emitAsync(pool);
+    EXPECT_THROW(future.get(), std::runtime_error);
+    EXPECT_EQ(1u, functionCallCount);
+}
+
+// A blocked signal, or a signal without slots, returns a ready future with an empty collector.
+TEST_F(AsyncSignalTest, emitAsyncBlocked)
+{
+    comp::Signal<void()> signal;
+    EXPECT_EQ(0u, signal.emitAsync(pool).get().size());
+
+    signal.connect(&SignalTest::function);
+    signal.setBlocked(true);
+    EXPECT_EQ(0u, signal.emitAsync(pool).get().size());
+    EXPECT_EQ(0u, functionCallCount);
+}
+
+// The asynchronous emission completes when the signal is destroyed while its slots are activated.
+TEST_F(AsyncSignalTest, destroySignalDuringEmitAsync)
+{
+    std::atomic_bool entered = false;
+    std::atomic_bool release = false;
+    std::future<comp::DefaultSignalCollector<void>> future;
+    {
+        comp::Signal<void(std::string)> signal;
+        signal.connect([&entered, &release](std::string value)
+        {
+            entered = true;
+            while (!release)
+            {
+                std::this_thread::yield();
+            }
+            stringValue = value;
+        });
+        future = signal.emitAsync(pool, std::string("copied"));
+        while (!entered)
+        {
+            std::this_thread::yield();
+        }
+    }
+    release = true;
+    // The slot is disconnected with the signal, but it was activated.
+    EXPECT_EQ(1u, future.get().size());
+    EXPECT_EQ("copied", stringValue);
+}
+
+#endif
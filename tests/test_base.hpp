@@ -3,6 +3,8 @@
 
 #include <gtest/gtest.h>
 #include <comp/signal.hpp>
+#include <string>
+#include <vector>
 
 class SignalTest : public ::testing::Test
 {
@@ -54,4 +56,55 @@ public:
     }
 };
 
+/// An argument that counts its copies and moves.
+struct Payload
+{
+    explicit Payload(const std::string& text)
+        : text(text)
+    {
+    }
+    Payload(const Payload& other)
+        : text(other.text)
+    {
+        ++copyCount;
+    }
+    Payload(Payload&& other)
+        : text(std::move(other.text))
+    {
+        ++moveCount;
+    }
+
+    std::string text;
+    static inline int copyCount = 0;
+    static inline int moveCount = 0;
+};
+
+/// A receiver of method slots.
+class Receiver : public comp::enable_shared_from_this<Receiver>
+{
+public:
+    void slot()
+    {
+    }
+
+    void setValue(int value)
+    {
+        this->value = value;
+    }
+
+    int value = 0;
+};
+
+/// A collector that collects the result of the first slot only.
+class FirstOnly : public comp::Collector<FirstOnly>
+{
+public:
+    bool handleResult(comp::Connection, int result)
+    {
+        results.push_back(result);
+        return false;
+    }
+    std::vector<int> results;
+};
+
 #endif // TEST_BASE_HPP
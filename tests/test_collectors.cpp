@@ -0,0 +1,136 @@
+#include "test_base.hpp"
+#include <comp/collectors.hpp>
+#include <comp/signal.hpp>
+#include <comp/static_signal.hpp>
+#include <string>
+
+namespace
+{
+
+int three()
+{
+    return 3;
+}
+
+int seven()
+{
+    return 7;
+}
+
+}
+
+class CollectorsTest : public SignalTest
+{
+public:
+    explicit CollectorsTest()
+    {
+        intSignal.connect([]() { return 5; });
+        intSignal.connect([]() { return -2; });
+        intSignal.connect([]() { return 8; });
+        intSignal.connect([]() { return -2; });
+    }
+
+    comp::Signal<int()> intSignal;
+};
+
+// The reducing collectors fold the results of the slots.
+TEST_F(CollectorsTest, reduce)
+{
+    auto sum = intSignal.operator()<comp::SumCollector<int>>();
+    EXPECT_EQ(9, sum.get());
+    EXPECT_EQ(4u, sum.size());
+
+    auto min = intSignal.operator()<comp::MinCollector<int>>();
+    ASSERT_TRUE(min.get());
+    EXPECT_EQ(-2, *min.get());
+
+    auto max = intSignal.operator()<comp::MaxCollector<int>>();
+    ASSERT_TRUE(max.get());
+    EXPECT_EQ(8, *max.get());
+
+    auto last = intSignal.operator()<comp::LastCollector<int>>();
+    ASSERT_TRUE(last.get());
+    EXPECT_EQ(-2, *last.get());
+}
+
+// The reducing collectors of a signal without slots hold no result.
+TEST_F(CollectorsTest, reduceWithoutSlots)
+{
+    comp::Signal<int()> signal;
+    EXPECT_EQ(0, signal.operator()<comp::SumCollector<int>>().get());
+    EXPECT_FALSE(signal.operator()<comp::MinCollector<int>>().get());
+    EXPECT_FALSE(signal.operator()<comp::MaxCollector<int>>().get());
+    EXPECT_FALSE(signal.operator()<comp::LastCollector<int>>().get());
+    EXPECT_FALSE(signal.operator()<comp::AnyCollector>().get());
+    EXPECT_TRUE(signal.operator()<comp::AllCollector>().get());
+}
+
+// The first non-null collector stops the emission at the first slot with non-null result.
+TEST_F(CollectorsTest, firstNonNull)
+{
+    std::string text = "text";
+    comp::Signal<std::string*()> signal;
+    signal.connect([]() -> std::string* { return nullptr; });
+    signal.connect([&text]() { return &text; });
+    signal.connect([]() -> std::string* { ++functionCallCount; return nullptr; });
+
+    auto collector = signal.operator()<comp::FirstNonNullCollector<std::string*>>();
+    EXPECT_EQ(&text, collector.get());
+    EXPECT_EQ(2u, collector.size());
+    EXPECT_EQ(0u, functionCallCount);
+}
+
+// The any and all collectors stop the emission at the first slot that decides the result.
+TEST_F(CollectorsTest, anyAndAll)
+{
+    comp::Signal<bool(int)> signal;
+    signal.connect([](int value) { return value > 0; });
+    signal.connect([](int value) { return value > 10; });
+    signal.connect([](int value) { return value > 100; });
+
+    auto any = signal.operator()<comp::AnyCollector>(5);
+    EXPECT_TRUE(any.get());
+    EXPECT_EQ(1u, any.size());
+    EXPECT_FALSE(signal.operator()<comp::AnyCollector>(0).get());
+
+    auto all = signal.operator()<comp::AllCollector>(50);
+    EXPECT_FALSE(all.get());
+    EXPECT_EQ(3u, all.size());
+    EXPECT_TRUE(signal.operator()<comp::AllCollector>(500).get());
+}
+
+// A caller-owned collector is reused across emissions, keeping the storage of its results.
+TEST_F(CollectorsTest, emitWithCallerOwnedCollector)
+{
+    comp::DefaultSignalCollector<int> results;
+    intSignal.emit(results);
+    EXPECT_EQ((std::vector<int>{5, -2, 8, -2}), static_cast<const std::vector<int>&>(results));
+
+    const auto storage = results.data();
+    results.clear();
+    intSignal.emit(results);
+    EXPECT_EQ(4u, results.size());
+    EXPECT_EQ(storage, results.data());
+
+    comp::SumCollector<int> sum;
+    intSignal.emit(sum);
+    EXPECT_EQ(18, intSignal.emit(sum).get());
+}
+
+// Member signals and static signals take caller-owned collectors.
+TEST_F(CollectorsTest, emitMemberAndStaticSignal)
+{
+    class Object : public comp::enable_shared_from_this<Object>
+    {
+    public:
+        comp::Signal<int(Object::*)(int)> signal{*this};
+    };
+    auto object = comp::make_shared<Object>();
+    object->signal.connect([](int value) { return value * 2; });
+    comp::MaxCollector<int> max;
+    EXPECT_EQ(6, *object->signal.emit(max, 3).get());
+
+    comp::StaticSignal<int(), &three, &seven> staticSignal;
+    comp::SumCollector<int> sum;
+    EXPECT_EQ(10, staticSignal.emit(sum).get());
+}
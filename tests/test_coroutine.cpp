@@ -0,0 +1,216 @@
+#include "test_base.hpp"
+
+#ifdef COMP_CONFIG_COROUTINES_ENABLED
+
+#include <comp/coroutine.hpp>
+#include <optional>
+
+namespace
+{
+
+/// A coroutine that starts eagerly, and keeps its frame until the owner destroys it.
+struct Task
+{
+    struct promise_type
+    {
+        Task get_return_object()
+        {
+            return Task{std::coroutine_handle<promise_type>::from_promise(*this)};
+        }
+        std::suspend_never initial_suspend() noexcept
+        {
+            return {};
+        }
+        std::suspend_always final_suspend() noexcept
+        {
+            return {};
+        }
+        void return_void()
+        {
+        }
+        void unhandled_exception()
+        {
+            std::terminate();
+        }
+    };
+
+    explicit Task(std::coroutine_handle<promise_type> handle)
+        : handle(handle)
+    {
+    }
+    Task(Task&& other)
+        : handle(std::exchange(other.handle, nullptr))
+    {
+    }
+    ~Task()
+    {
+        if (handle)
+        {
+            handle.destroy();
+        }
+    }
+
+    bool isDone() const
+    {
+        return handle.done();
+    }
+
+    std::coroutine_handle<promise_type> handle;
+};
+
+}
+
+class CoroutineTest : public SignalTest
+{
+};
+
+// The application developer can await a signal without arguments from a coroutine.
+TEST_F(CoroutineTest, awaitSignal)
+{
+    comp::Signal<void()> signal;
+    signal.connect(&SignalTest::function);
+
+    auto coroutine = [&signal]() -> Task
+    {
+        co_await signal;
+        ++functionCallCount;
+    };
+    auto task = coroutine();
+    EXPECT_FALSE(task.isDone());
+
+    // The slots are activated before the coroutine is resumed.
+    EXPECT_EQ(1u, signal().size());
+    EXPECT_EQ(2u, functionCallCount);
+    EXPECT_TRUE(task.isDone());
+}
+
+// The coroutine awaiting a signal gets the arguments of the emission.
+TEST_F(CoroutineTest, awaitArguments)
+{
+    comp::Signal<void(int)> intSignal;
+    comp::Signal<int(int, std::string)> pairSignal;
+    std::vector<int> values;
+    std::string text;
+
+    auto coroutine = [&]() -> Task
+    {
+        values.push_back(co_await intSignal);
+        values.push_back(co_await intSignal);
+        auto [value, string] = co_await pairSignal;
+        values.push_back(value);
+        text = string;
+    };
+    auto task = coroutine();
+
+    intSignal(1);
+    pairSignal(10, "ignored");
+    intSignal(2);
+    intSignal(3);
+    pairSignal(4, "text");
+    EXPECT_TRUE(task.isDone());
+    EXPECT_EQ((std::vector<int>{1, 2, 4}), values);
+    EXPECT_EQ("text", text);
+}
+
+// Each emission resumes the coroutines awaiting the signal, in the order they started to wait.
+TEST_F(CoroutineTest, multipleWaiters)
+{
+    comp::Signal<void(int)> signal;
+    std::vector<int> values;
+    auto coroutine = [&signal, &values](int id) -> Task
+    {
+        const auto value = co_await signal;
+        values.push_back(id * 10 + value);
+    };
+    auto task1 = coroutine(1);
+    auto task2 = coroutine(2);
+
+    signal(5);
+    EXPECT_EQ((std::vector<int>{15, 25}), values);
+
+    signal(6);
+    EXPECT_EQ(2u, values.size());
+}
+
+// A blocked signal does not resume the coroutines.
+TEST_F(CoroutineTest, blockedSignal)
+{
+    comp::Signal<void()> signal;
+    auto coroutine = [&signal]() -> Task
+    {
+        co_await signal;
+    };
+    auto task = coroutine();
+
+    signal.setBlocked(true);
+    signal();
+    EXPECT_FALSE(task.isDone());
+
+    signal.setBlocked(false);
+    signal();
+    EXPECT_TRUE(task.isDone());
+}
+
+// The coroutine destroyed while awaiting a signal leaves the signal.
+TEST_F(CoroutineTest, destroyAwaitingCoroutine)
+{
+    comp::Signal<void()> signal;
+    auto coroutine = [&signal]() -> Task
+    {
+        co_await signal;
+        ++functionCallCount;
+    };
+    {
+        auto task1 = coroutine();
+    }
+    auto task2 = coroutine();
+    {
+        auto task3 = coroutine();
+    }
+
+    signal();
+    EXPECT_TRUE(task2.isDone());
+    EXPECT_EQ(1u, functionCallCount);
+}
+
+// The coroutine destroyed by an other coroutine resumed by the same emission leaves the signal unresumed.
+TEST_F(CoroutineTest, destroyAwaitingCoroutineFromResumedCoroutine)
+{
+    comp::Signal<void(int)> signal;
+    std::optional<Task> task2;
+    auto coroutine1 = [&signal, &task2]() -> Task
+    {
+        co_await signal;
+        task2.reset();
+    };
+    auto coroutine2 = [&signal]() -> Task
+    {
+        co_await signal;
+        ++functionCallCount;
+    };
+    auto task1 = coroutine1();
+    task2.emplace(coroutine2());
+
+    signal(1);
+    EXPECT_TRUE(task1.isDone());
+    EXPECT_FALSE(task2);
+    EXPECT_EQ(0u, functionCallCount);
+}
+
+// The coroutine awaiting a signal is not resumed when the signal is destroyed.
+TEST_F(CoroutineTest, destroySignal)
+{
+    auto signal = std::make_unique<comp::Signal<void()>>();
+    auto coroutine = [&signal]() -> Task
+    {
+        co_await *signal;
+        ++functionCallCount;
+    };
+    auto task = coroutine();
+
+    signal.reset();
+    EXPECT_FALSE(task.isDone());
+    EXPECT_EQ(0u, functionCallCount);
+}
+
+#endif
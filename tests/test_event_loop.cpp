@@ -0,0 +1,222 @@
+#include "test_base.hpp"
+#include <comp/signal.hpp>
+#include <comp/utility/event_loop.hpp>
+
+#ifdef COMP_CONFIG_THREAD_ENABLED
+#include <thread>
+#endif
+
+class EventLoopTest : public SignalTest
+{
+public:
+    comp::EventLoop loop;
+};
+
+// The application developer can connect a slot to a signal with a queued connection. The slot is activated
+// when the event loop processes the events.
+TEST_F(EventLoopTest, queuedConnection)
+{
+    comp::Signal<void(int)> signal;
+    auto connection = signal.connect(loop, &SignalTest::functionWithIntArgument);
+    EXPECT_TRUE(connection);
+
+    EXPECT_EQ(1u, signal(10).size());
+    EXPECT_EQ(0u, intValue);
+
+    EXPECT_EQ(1u, loop.processEvents());
+    EXPECT_EQ(10u, intValue);
+    EXPECT_EQ(0u, loop.processEvents());
+}
+
+// The queued connection copies the arguments once, and moves them to the slot.
+TEST_F(EventLoopTest, queuedConnectionCopiesArgumentsOnce)
+{
+    comp::Signal<void(Payload)> signal;
+    std::vector<std::string> texts;
+    signal.connect(loop, [&texts](Payload payload) { texts.push_back(payload.text); });
+
+    Payload payload("payload");
+    Payload::copyCount = 0;
+    Payload::moveCount = 0;
+    signal(payload);
+    EXPECT_EQ(1, Payload::copyCount);
+
+    loop.processEvents();
+    EXPECT_EQ((std::vector<std::string>{"payload"}), texts);
+    EXPECT_EQ(1, Payload::copyCount);
+    EXPECT_EQ(1, Payload::moveCount);
+}
+
+// The events are delivered in the order they were posted. Events posted during the delivery are delivered
+// with the next batch.
+TEST_F(EventLoopTest, deliverInBatches)
+{
+    comp::Signal<void(int)> signal;
+    std::vector<int> values;
+    signal.connect(loop, [&signal, &values](int value)
+    {
+        values.push_back(value);
+        if (value == 2)
+        {
+            signal(3);
+        }
+    });
+
+    signal(1);
+    signal(2);
+    EXPECT_EQ(2u, loop.processEvents());
+    EXPECT_EQ((std::vector<int>{1, 2}), values);
+    EXPECT_EQ(1u, loop.processEvents());
+    EXPECT_EQ((std::vector<int>{1, 2, 3}), values);
+}
+
+// The event of a slot disconnected before the delivery is dropped.
+TEST_F(EventLoopTest, disconnectBeforeDelivery)
+{
+    comp::Signal<void()> signal;
+    auto connection = signal.connect(loop, &SignalTest::function);
+
+    signal();
+    connection.disconnect();
+    loop.processEvents();
+    EXPECT_EQ(0u, functionCallCount);
+}
+
+// The trackers of a queued connection are checked when the event is delivered.
+TEST_F(EventLoopTest, trackerCheckedOnDelivery)
+{
+    comp::Signal<void()> signal;
+    auto tracker = comp::make_shared<int>(0);
+    auto connection = signal.connect(loop, &SignalTest::function).bind(tracker);
+
+    signal();
+    tracker.reset();
+    loop.processEvents();
+    EXPECT_EQ(0u, functionCallCount);
+    EXPECT_FALSE(connection);
+}
+
+// The application developer can connect a method with a queued connection. The event is dropped if the
+// receiver is destroyed before the delivery.
+TEST_F(EventLoopTest, queuedMethod)
+{
+    comp::Signal<void(int)> signal;
+    auto receiver = comp::make_shared<Receiver>();
+    signal.connect(loop, receiver, &Receiver::setValue);
+
+    signal(5);
+    loop.processEvents();
+    EXPECT_EQ(5, receiver->value);
+
+    signal(6);
+    receiver.reset();
+    loop.processEvents();
+}
+
+// The queued connection is disconnected when its event loop is destroyed.
+TEST_F(EventLoopTest, destroyLoop)
+{
+    comp::Signal<void(Payload)> signal;
+    comp::Connection connection;
+    {
+        comp::EventLoop scopedLoop;
+        connection = signal.connect(scopedLoop, [](Payload) { ++functionCallCount; });
+        signal(Payload("pending"));
+    }
+    EXPECT_TRUE(connection);
+    EXPECT_EQ(0u, signal(Payload("dropped")).size());
+    EXPECT_FALSE(connection);
+    EXPECT_EQ(0u, functionCallCount);
+}
+
+// The events reuse the blocks of the delivered events.
+TEST_F(EventLoopTest, recycleDeliveredEvents)
+{
+    struct AddressEvent : public comp::EventLoop::Event
+    {
+        explicit AddressEvent(std::vector<void*>& addresses)
+        {
+            addresses.push_back(this);
+        }
+        void dispatch() override
+        {
+        }
+    };
+
+    std::vector<void*> addresses;
+    auto queue = loop.getQueue();
+    EXPECT_TRUE(queue->post<AddressEvent>(addresses));
+    EXPECT_TRUE(queue->post<AddressEvent>(addresses));
+    EXPECT_EQ(2u, loop.processEvents());
+
+    EXPECT_TRUE(queue->post<AddressEvent>(addresses));
+    EXPECT_TRUE(queue->post<AddressEvent>(addresses));
+    ASSERT_EQ(4u, addresses.size());
+    EXPECT_TRUE(addresses[2] == addresses[0] || addresses[2] == addresses[1]);
+    EXPECT_TRUE(addresses[3] == addresses[0] || addresses[3] == addresses[1]);
+    EXPECT_NE(addresses[2], addresses[3]);
+    EXPECT_EQ(2u, loop.processEvents());
+}
+
+#ifdef COMP_CONFIG_THREAD_ENABLED
+// The queued slots run on the thread of the event loop.
+TEST_F(EventLoopTest, deliverOnLoopThread)
+{
+    constexpr int emitCount = 1000;
+    comp::Signal<void(int)> signal;
+    std::thread::id slotThread;
+    int sum = 0;
+    signal.connect(loop, [&slotThread, &sum](int value)
+    {
+        slotThread = std::this_thread::get_id();
+        sum += value;
+    });
+
+    std::thread loopThread([this]() { loop.run(); });
+    const auto loopThreadId = loopThread.get_id();
+    for (auto i = 1; i <= emitCount; ++i)
+    {
+        signal(i);
+    }
+    comp::Signal<void()> stop;
+    stop.connect(loop, [this]() { loop.quit(); });
+    stop();
+    loopThread.join();
+
+    EXPECT_EQ(loopThreadId, slotThread);
+    EXPECT_EQ(emitCount * (emitCount + 1) / 2, sum);
+}
+
+// Multiple threads can post to the same event loop.
+TEST_F(EventLoopTest, postFromMultipleThreads)
+{
+    constexpr int threadCount = 4;
+    constexpr int emitCount = 1000;
+    comp::Signal<void()> signal;
+    int count = 0;
+    signal.connect(loop, [&count]() { ++count; });
+
+    std::vector<std::thread> threads;
+    for (auto i = 0; i < threadCount; ++i)
+    {
+        threads.emplace_back([&signal]()
+        {
+            for (auto j = 0; j < emitCount; ++j)
+            {
+                signal();
+            }
+        });
+    }
+
+    auto delivered = 0u;
+    while (count < threadCount * emitCount)
+    {
+        delivered += loop.processEvents();
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+    EXPECT_EQ(size_t(threadCount * emitCount), delivered);
+}
+#endif
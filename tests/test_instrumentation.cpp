@@ -0,0 +1,195 @@
+#include "test_base.hpp"
+
+#ifdef COMP_CONFIG_INSTRUMENTATION_ENABLED
+
+#include <comp/sharded_signal.hpp>
+#include <comp/utility/instrumentation.hpp>
+#include <numeric>
+
+#ifdef COMP_CONFIG_THREAD_ENABLED
+#include <thread>
+#endif
+
+namespace
+{
+
+const comp::SignalSnapshot* findSignal(const std::vector<comp::SignalSnapshot>& snapshot, const comp::core::Signal& signal)
+{
+    for (auto& entry : snapshot)
+    {
+        if (entry.signal == &signal)
+        {
+            return &entry;
+        }
+    }
+    return nullptr;
+}
+
+size_t getCount(const comp::LatencyHistogram::Buckets& buckets)
+{
+    return std::accumulate(buckets.begin(), buckets.end(), size_t(0u));
+}
+
+}
+
+class InstrumentationTest : public SignalTest
+{
+};
+
+// The histogram buckets grow exponentially, the last bucket counts the durations that do not fit the others.
+TEST_F(InstrumentationTest, histogramBuckets)
+{
+    using namespace std::chrono_literals;
+    EXPECT_EQ(0u, comp::LatencyHistogram::getBucket(0ns));
+    EXPECT_EQ(0u, comp::LatencyHistogram::getBucket(1ns));
+    EXPECT_EQ(1u, comp::LatencyHistogram::getBucket(2ns));
+    EXPECT_EQ(1u, comp::LatencyHistogram::getBucket(3ns));
+    EXPECT_EQ(10u, comp::LatencyHistogram::getBucket(1024ns));
+    EXPECT_EQ(comp::LatencyHistogram::BucketCount - 1u, comp::LatencyHistogram::getBucket(1h));
+
+    comp::LatencyHistogram histogram;
+    histogram.record(3ns);
+    histogram.record(1024ns);
+    histogram.record(1500ns);
+    auto buckets = histogram.getBuckets();
+    EXPECT_EQ(1u, buckets[1]);
+    EXPECT_EQ(2u, buckets[10]);
+    EXPECT_EQ(3u, getCount(buckets));
+}
+
+// The signal counts the emissions and the slot activations.
+TEST_F(InstrumentationTest, countEmitsAndActivations)
+{
+    comp::Signal<void()> signal;
+    signal.connect(&SignalTest::function);
+    signal.connect([]() {});
+
+    signal();
+    signal();
+    auto counters = signal.getStatistics()->getCounters();
+    EXPECT_EQ(2u, counters.emitCount);
+    EXPECT_EQ(4u, counters.activationCount);
+    EXPECT_EQ(0u, counters.blockedCount);
+    EXPECT_EQ(0u, counters.reentrantCount);
+}
+
+// The signal counts the emissions dropped because the signal is blocked, or emitted from its slots.
+TEST_F(InstrumentationTest, countDroppedEmits)
+{
+    comp::Signal<void()> signal;
+    signal.connect([&signal]() { signal(); });
+
+    signal();
+    signal.setBlocked(true);
+    signal();
+    signal();
+    auto counters = signal.getStatistics()->getCounters();
+    EXPECT_EQ(1u, counters.emitCount);
+    EXPECT_EQ(1u, counters.activationCount);
+    EXPECT_EQ(2u, counters.blockedCount);
+    EXPECT_EQ(1u, counters.reentrantCount);
+}
+
+// The signal counts the slots disconnected because their trackers or receivers were destroyed.
+TEST_F(InstrumentationTest, countAutoDisconnects)
+{
+    comp::Signal<void()> signal;
+    auto tracker = comp::make_shared<int>(0);
+    auto receiver = comp::make_shared<Receiver>();
+    signal.connect(&SignalTest::function).bind(tracker);
+    signal.connect(receiver, &Receiver::slot);
+    auto connection = signal.connect(&SignalTest::function);
+
+    tracker.reset();
+    receiver.reset();
+    connection.disconnect();
+    signal();
+    signal();
+    auto counters = signal.getStatistics()->getCounters();
+    EXPECT_EQ(2u, counters.autoDisconnectCount);
+    EXPECT_EQ(0u, counters.activationCount);
+}
+
+// The batch emission counts an emission and an activation for each event of the batch.
+TEST_F(InstrumentationTest, countBatch)
+{
+    comp::Signal<void(int)> signal;
+    signal.connect([](int) {});
+    signal.connectBatch([](comp::signal_batch_t<int>) {});
+
+    std::vector<std::tuple<int>> events = {{1}, {2}, {3}};
+    signal.emitBatch(events);
+    auto counters = signal.getStatistics()->getCounters();
+    EXPECT_EQ(3u, counters.emitCount);
+    EXPECT_EQ(6u, counters.activationCount);
+}
+
+// The registry holds the signals alive, with the activation time histograms of their connected slots.
+TEST_F(InstrumentationTest, registrySnapshot)
+{
+    auto signal = std::make_unique<comp::Signal<void()>>();
+    signal->setStatisticsName("signal");
+    signal->connect(&SignalTest::function);
+    signal->connect([]() {});
+    signal->connect([]() {}).disconnect();
+    (*signal)();
+    (*signal)();
+
+    auto snapshot = comp::StatisticsRegistry::get().snapshot();
+    auto entry = findSignal(snapshot, *signal);
+    ASSERT_NE(nullptr, entry);
+    EXPECT_EQ("signal", entry->name);
+    EXPECT_EQ(2u, entry->counters.emitCount);
+    ASSERT_EQ(2u, entry->slotActivationTimes.size());
+    EXPECT_EQ(2u, getCount(entry->slotActivationTimes[0]));
+    EXPECT_EQ(2u, getCount(entry->slotActivationTimes[1]));
+
+    const comp::core::Signal* destroyed = signal.get();
+    signal.reset();
+    EXPECT_EQ(nullptr, findSignal(comp::StatisticsRegistry::get().snapshot(), *destroyed));
+}
+
+#ifdef COMP_CONFIG_THREAD_ENABLED
+// The registry snapshot can be taken while the signals are created, emitted, connected and destroyed on other
+// threads.
+TEST_F(InstrumentationTest, snapshotWhileEmitting)
+{
+    constexpr int emitCount = 10000;
+    comp::Signal<void()> signal;
+    signal.connect([]() {});
+
+    std::atomic_bool done = false;
+    std::thread emitter([&signal, &done]()
+    {
+        for (auto i = 0; i < emitCount; ++i)
+        {
+            signal();
+            if (i % 100 == 0)
+            {
+                comp::Signal<void()> temporary;
+                temporary.connect([]() {});
+                temporary();
+                // The snapshots read the shards of a sharded signal as soon as the signal is registered.
+                comp::ShardedSignal<void()> sharded(4u);
+                sharded.connect([]() {});
+                signal.connect([]() {}).disconnect();
+            }
+        }
+        done = true;
+    });
+
+    auto lastCount = size_t(0u);
+    while (!done)
+    {
+        auto snapshot = comp::StatisticsRegistry::get().snapshot();
+        auto entry = findSignal(snapshot, signal);
+        ASSERT_NE(nullptr, entry);
+        EXPECT_LE(lastCount, entry->counters.emitCount);
+        lastCount = entry->counters.emitCount;
+    }
+    emitter.join();
+    EXPECT_EQ(size_t(emitCount), signal.getStatistics()->getCounters().emitCount);
+}
+#endif
+
+#endif
@@ -1,6 +1,7 @@
 #include <gtest/gtest.h>
 
 #include <comp/wrap/memory.hpp>
+#include <comp/utility/memory_pool.hpp>
 
 namespace
 {
@@ -48,6 +49,24 @@ TEST(MemoryTraits, detectWeakPtr)
     EXPECT_TRUE(comp::is_weak_ptr_v<WeakPtr>);
 }
 
+TEST(Memory, memoryPoolRecyclesBlocks)
+{
+    auto pool = comp::make_intrusive<comp::MemoryPool>();
+    auto block1 = pool->allocate(24u);
+    auto block2 = pool->allocate(24u);
+    EXPECT_NE(block1, block2);
+    pool->deallocate(block1, 24u);
+    // The released block is reused for the same size class.
+    EXPECT_EQ(block1, pool->allocate(32u));
+    pool->deallocate(block1, 32u);
+    pool->deallocate(block2, 24u);
+
+    // Blocks over the size limit are allocated from the heap.
+    auto large = pool->allocate(comp::MemoryPool::maxBlockSize + 1u);
+    EXPECT_NE(nullptr, large);
+    pool->deallocate(large, comp::MemoryPool::maxBlockSize + 1u);
+}
+
 int main(int argc, char** argv)
 {
     ::testing::InitGoogleTest(&argc, argv);
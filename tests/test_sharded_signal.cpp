@@ -0,0 +1,129 @@
+#include "test_base.hpp"
+#include <comp/sharded_signal.hpp>
+#include <algorithm>
+
+#ifdef COMP_CONFIG_THREAD_ENABLED
+#include <thread>
+#endif
+
+class ShardedSignalTest : public SignalTest
+{
+};
+
+// The sharded signal activates the slots of all its shards.
+TEST_F(ShardedSignalTest, emit)
+{
+    comp::ShardedSignal<void(int)> signal(4u);
+    EXPECT_EQ(4u, signal.getShardCount());
+
+    int sum = 0;
+    for (auto i = 1; i <= 100; ++i)
+    {
+        signal.connect([&sum, i](int value) { sum += i * value; });
+    }
+    EXPECT_EQ(100u, signal(2).size());
+    EXPECT_EQ(5050 * 2, sum);
+}
+
+// The sharded signal has at least one shard.
+TEST_F(ShardedSignalTest, atLeastOneShard)
+{
+    comp::ShardedSignal<void()> signal(0u);
+    EXPECT_EQ(1u, signal.getShardCount());
+    signal.connect(&SignalTest::function);
+    EXPECT_EQ(1u, signal().size());
+}
+
+// The slots of a sharded signal are disconnected from their shards.
+TEST_F(ShardedSignalTest, disconnect)
+{
+    comp::ShardedSignal<int()> signal(8u);
+    std::vector<comp::Connection> connections;
+    for (auto i = 0; i < 64; ++i)
+    {
+        connections.push_back(signal.connect([i]() { return i; }));
+    }
+
+    for (auto i = 0u; i < connections.size(); i += 2u)
+    {
+        signal.disconnect(connections[i]);
+    }
+    auto result = signal();
+    ASSERT_EQ(32u, result.size());
+    std::sort(result.begin(), result.end());
+    for (auto i = 0u; i < result.size(); ++i)
+    {
+        EXPECT_EQ(int(i * 2u + 1u), result[i]);
+    }
+
+    for (auto& connection : connections)
+    {
+        connection.disconnect();
+    }
+    EXPECT_EQ(0u, signal().size());
+}
+
+// The slots of a sharded signal are disconnected when the signal is destroyed.
+TEST_F(ShardedSignalTest, destroy)
+{
+    std::vector<comp::Connection> connections;
+    {
+        comp::ShardedSignal<void()> signal(4u);
+        for (auto i = 0; i < 16; ++i)
+        {
+            connections.push_back(signal.connect(&SignalTest::function));
+        }
+    }
+    for (auto& connection : connections)
+    {
+        EXPECT_FALSE(connection);
+    }
+}
+
+// The sharded signal supports the batch emission and the signal connections.
+TEST_F(ShardedSignalTest, emitBatchAndConnectSignal)
+{
+    comp::ShardedSignal<void(int)> signal(4u);
+    comp::Signal<void(int)> receiver;
+    int sum = 0;
+    receiver.connect([&sum](int value) { sum += value; });
+    signal.connect(receiver);
+    signal.connect([&sum](int value) { sum += value; });
+
+    std::vector<std::tuple<int>> events = {{1}, {2}, {3}};
+    EXPECT_EQ(6u, signal.emitBatch(events).size());
+    EXPECT_EQ(12, sum);
+}
+
+#ifdef COMP_CONFIG_THREAD_ENABLED
+// Multiple threads connect and disconnect slots on a sharded signal while the signal is emitted.
+TEST_F(ShardedSignalTest, connectFromMultipleThreads)
+{
+    constexpr int threadCount = 8;
+    constexpr int connectCount = 1000;
+    comp::ShardedSignal<void()> signal(4u);
+    std::atomic_int activationCount = 0;
+    signal.connect([&activationCount]() { ++activationCount; });
+
+    std::vector<std::thread> threads;
+    for (auto i = 0; i < threadCount; ++i)
+    {
+        threads.emplace_back([&signal]()
+        {
+            for (auto j = 0; j < connectCount; ++j)
+            {
+                auto connection = signal.connect([]() {});
+                signal();
+                connection.disconnect();
+            }
+        });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    EXPECT_EQ(threadCount * connectCount, activationCount.load());
+    EXPECT_EQ(1u, signal().size());
+}
+#endif
@@ -1,9 +1,47 @@
 #include "test_base.hpp"
 #include <comp/signal.hpp>
 
+#ifdef COMP_CONFIG_THREAD_ENABLED
+#include <chrono>
+#include <thread>
+#endif
+
 namespace
 {
 
+class CountingResource : public comp::MemoryResource
+{
+public:
+    void* allocate(size_t size) override
+    {
+        ++allocationCount;
+        return ::operator new(size);
+    }
+    void deallocate(void* block, size_t) override
+    {
+        ++deallocationCount;
+        ::operator delete(block);
+    }
+
+    static inline int allocationCount = 0;
+    static inline int deallocationCount = 0;
+};
+
+class ExpiredReceiverSlot : public comp::SlotConcept<int>
+{
+public:
+    explicit ExpiredReceiverSlot(comp::core::Signal& signal)
+        : comp::SlotConcept<int>(signal)
+    {
+    }
+
+protected:
+    ActivationResult activateOverride() override
+    {
+        return {};
+    }
+};
+
 class Object1 : public comp::enable_shared_from_this<Object1>
 {
 public:
@@ -67,6 +105,58 @@ TEST_F(SignalTest, connectToFunctionWithRefArgument)
     EXPECT_EQ(20, ivalue);
 }
 
+// The signal passes the same arguments to all its slots. Slots taking the argument by value get a copy of the
+// argument, and the argument is never moved from.
+TEST_F(SignalTest, passArgumentsToSlots)
+{
+    comp::Signal<void(Payload)> signal;
+    std::vector<std::string> texts;
+    auto slot = [&texts](Payload payload)
+    {
+        texts.push_back(payload.text);
+    };
+    signal.connect(slot);
+    signal.connect(slot);
+
+    Payload payload("payload");
+    Payload::copyCount = 0;
+    Payload::moveCount = 0;
+    EXPECT_EQ(2u, signal(payload).size());
+    EXPECT_EQ((std::vector<std::string>{"payload", "payload"}), texts);
+    EXPECT_EQ(2, Payload::copyCount);
+    EXPECT_EQ(0, Payload::moveCount);
+}
+
+// Slots can take the by-value arguments of a signal as const references. These slots get no copy of the
+// argument.
+TEST_F(SignalTest, passArgumentsToReferenceSlots)
+{
+    struct PayloadReceiver : public comp::enable_shared_from_this<PayloadReceiver>
+    {
+        void slot(const Payload& payload)
+        {
+            texts.push_back(payload.text);
+        }
+        std::vector<std::string> texts;
+    };
+
+    comp::Signal<void(Payload)> signal;
+    std::vector<std::string> texts;
+    auto receiver = comp::make_shared<PayloadReceiver>();
+    signal.connect([&texts](const Payload& payload) { texts.push_back(payload.text); });
+    signal.connect([&texts](comp::Connection, const Payload& payload) { texts.push_back(payload.text); });
+    signal.connect(receiver, &PayloadReceiver::slot);
+
+    Payload payload("payload");
+    Payload::copyCount = 0;
+    Payload::moveCount = 0;
+    EXPECT_EQ(3u, signal(payload).size());
+    EXPECT_EQ((std::vector<std::string>{"payload", "payload"}), texts);
+    EXPECT_EQ((std::vector<std::string>{"payload"}), receiver->texts);
+    EXPECT_EQ(0, Payload::copyCount);
+    EXPECT_EQ(0, Payload::moveCount);
+}
+
 // The application developer can connect a signal to a method.
 TEST_F(SignalTest, connectToMethod)
 {
@@ -154,6 +244,122 @@ TEST_F(SignalTest, emitSignalThatActivatedTheSlot)
     EXPECT_EQ(1u, signal().size());
 }
 
+// When the application developer emits a signal from a slot of an other signal, the signal is activated.
+TEST_F(SignalTest, emitOtherSignalFromSlot)
+{
+    comp::Signal<void()> signal1;
+    comp::Signal<void()> signal2;
+    signal2.connect(&function);
+
+    auto slot = [&signal2]()
+    {
+        EXPECT_EQ(1u, signal2().size());
+    };
+    signal1.connect(slot);
+
+    EXPECT_EQ(1u, signal1().size());
+    EXPECT_EQ(1u, functionCallCount);
+}
+
+#ifdef COMP_CONFIG_THREAD_ENABLED
+// The application developer can emit the same signal from multiple threads at the same time.
+TEST_F(SignalTest, emitFromMultipleThreads)
+{
+    constexpr int threadCount = 4;
+    comp::Signal<void()> signal;
+    std::atomic_int enterCount = 0;
+
+    auto slot = [&enterCount]()
+    {
+        ++enterCount;
+        // Wait for the other emitters to enter the slot.
+        const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+        while (enterCount < threadCount && std::chrono::steady_clock::now() < deadline)
+        {
+            std::this_thread::yield();
+        }
+    };
+    signal.connect(slot);
+
+    std::atomic_int emitCount = 0;
+    std::vector<std::thread> threads;
+    for (int i = 0; i < threadCount; ++i)
+    {
+        threads.emplace_back([&signal, &emitCount]() { emitCount += int(signal().size()); });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+    EXPECT_EQ(threadCount, emitCount);
+    EXPECT_EQ(threadCount, enterCount);
+}
+
+// The emitters read the slots without locking while an other thread connects and disconnects slots.
+TEST_F(SignalTest, connectWhileEmittingFromMultipleThreads)
+{
+    constexpr int threadCount = 4;
+    comp::Signal<int()> signal;
+    signal.connect([]() { return 1; });
+
+    std::atomic_bool done = false;
+    std::atomic_int errorCount = 0;
+    std::vector<std::thread> threads;
+    for (int i = 0; i < threadCount; ++i)
+    {
+        threads.emplace_back([&signal, &done, &errorCount]()
+        {
+            while (!done)
+            {
+                auto results = signal();
+                const std::vector<int>& values = results;
+                if (values.empty() || values.front() != 1)
+                {
+                    ++errorCount;
+                }
+            }
+        });
+    }
+    for (int i = 0; i < 200; ++i)
+    {
+        signal.connect([]() { return 2; }).disconnect();
+    }
+    done = true;
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+    EXPECT_EQ(0, errorCount);
+    EXPECT_EQ(1u, signal().size());
+}
+
+// The application developer can wait for the in-flight activations of a slot when disconnecting it.
+TEST_F(SignalTest, disconnectWaitsForActivations)
+{
+    comp::Signal<void()> signal;
+    std::atomic_bool entered = false;
+    std::atomic_bool finished = false;
+
+    auto slot = [&entered, &finished]()
+    {
+        entered = true;
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        finished = true;
+    };
+    auto connection = signal.connect(slot);
+
+    std::thread emitter([&signal]() { signal(); });
+    while (!entered)
+    {
+        std::this_thread::yield();
+    }
+    connection.disconnect(true);
+    EXPECT_TRUE(finished);
+    EXPECT_FALSE(connection);
+    emitter.join();
+}
+#endif
+
 // It should be possible for an application developer to receive the connection that is associated to a slot as the first argument.
 TEST_F(SignalTest, slotWithConnection)
 {
@@ -194,6 +400,29 @@ TEST_F(SignalTest, methodSlotWithConnection)
     EXPECT_FALSE(voidConnection);
 }
 
+// The application developer can receive a view of the connection as the first argument of a slot.
+TEST_F(SignalTest, slotWithConnectionView)
+{
+    comp::Signal<void(int)> signal;
+    comp::Connection copied;
+    auto connection = signal.connect([&copied](comp::ConnectionView view, int value)
+    {
+        EXPECT_TRUE(view);
+        copied = view;
+        if (value > 1)
+        {
+            view.disconnect();
+        }
+    });
+
+    signal(1);
+    EXPECT_TRUE(connection);
+    EXPECT_EQ(connection, copied);
+    signal(2);
+    EXPECT_FALSE(connection);
+    EXPECT_EQ(0u, signal(3).size());
+}
+
 // The application developer can disconnect a connection from a signal using the signal disconnect function.
 TEST_F(SignalTest, disconnectWithSignal)
 {
@@ -210,6 +439,106 @@ TEST_F(SignalTest, disconnectWithSignal)
     EXPECT_EQ(0u, signal().size());
 }
 
+// When the application developer disconnects a connection of an other signal, the connection stays connected.
+TEST_F(SignalTest, disconnectConnectionOfOtherSignal)
+{
+    using SignalType = comp::Signal<void()>;
+    SignalType signal1;
+    SignalType signal2;
+    auto connection = signal1.connect([]() {});
+    signal2.disconnect(connection);
+    EXPECT_TRUE(connection);
+    EXPECT_EQ(1u, signal1().size());
+}
+
+// When the application developer disconnects a slot, the remaining slots keep their connection order.
+TEST_F(SignalTest, disconnectKeepsConnectionOrder)
+{
+    using SignalType = comp::Signal<void()>;
+    SignalType signal;
+    std::vector<int> order;
+    std::vector<comp::Connection> connections;
+    for (auto i = 0; i < 6; ++i)
+    {
+        connections.push_back(signal.connect([&order, i]() { order.push_back(i); }));
+    }
+    connections[1].disconnect();
+    signal.disconnect(connections[4]);
+    EXPECT_EQ(4u, signal().size());
+    EXPECT_EQ((std::vector<int>{0, 2, 3, 5}), order);
+}
+
+// The slots with higher priority are activated first, the slots with the same priority in connection order.
+TEST_F(SignalTest, connectWithPriority)
+{
+    comp::Signal<void()> signal;
+    std::vector<int> order;
+    signal.connect([&order]() { order.push_back(0); });
+    signal.connect(-1, [&order]() { order.push_back(1); });
+    signal.connect(10, [&order]() { order.push_back(2); });
+    signal.connect([&order]() { order.push_back(3); });
+    signal.connect(10, [&order]() { order.push_back(4); });
+    signal.connect(5, [&order]() { order.push_back(5); });
+
+    EXPECT_EQ(6u, signal().size());
+    EXPECT_EQ((std::vector<int>{2, 4, 5, 0, 3, 1}), order);
+}
+
+// Methods and signals can be connected with a priority.
+TEST_F(SignalTest, connectMethodAndSignalWithPriority)
+{
+    comp::Signal<void()> signal;
+    comp::Signal<void()> receiver;
+    auto object = comp::make_shared<Object1>();
+    std::vector<int> order;
+    receiver.connect([&order]() { order.push_back(2); });
+    signal.connect([&order]() { order.push_back(0); });
+    signal.connect(1, receiver);
+    signal.connect(2, object, &Object1::methodWithNoArg);
+    signal.connect(2, [&order, &object]() { order.push_back(int(object->methodCallCount)); });
+
+    EXPECT_EQ(4u, signal().size());
+    EXPECT_EQ((std::vector<int>{1, 2, 0}), order);
+}
+
+// The slots keep their priority order when slots are disconnected and the signal compacts its slots.
+TEST_F(SignalTest, disconnectKeepsPriorityOrder)
+{
+    comp::Signal<void()> signal;
+    std::vector<int> order;
+    std::vector<comp::Connection> connections;
+    for (auto i = 0; i < 8; ++i)
+    {
+        connections.push_back(signal.connect(i % 4, [&order, i]() { order.push_back(i); }));
+    }
+    for (auto i = 0u; i < connections.size(); i += 2u)
+    {
+        connections[i].disconnect();
+    }
+    signal.connect(2, [&order]() { order.push_back(8); });
+
+    EXPECT_EQ(5u, signal().size());
+    EXPECT_EQ((std::vector<int>{3, 7, 8, 1, 5}), order);
+}
+
+// When the signal is destroyed, all its connections are invalidated.
+TEST_F(SignalTest, destroySignalWithManySlots)
+{
+    using SignalType = comp::Signal<void()>;
+    auto signal = std::make_unique<SignalType>();
+    std::vector<comp::Connection> connections;
+    for (auto i = 0; i < 100; ++i)
+    {
+        connections.push_back(signal->connect([]() {}));
+    }
+    connections[50].disconnect();
+    signal.reset();
+    for (auto& connection : connections)
+    {
+        EXPECT_FALSE(connection);
+    }
+}
+
 // The application developer can connect the same function multiple times.
 TEST_F(SignalTest, connectFunctionManyTimes)
 {
@@ -310,6 +639,136 @@ TEST_F(SignalTest, connectionFromSlotGetsActivatedNextTime)
     EXPECT_EQ(1, functionCallCount);
 }
 
+// When the application developer disconnects a slot from an activated slot, the disconnected slot is not activated
+// in the same signal activation.
+TEST_F(SignalTest, disconnectFollowingSlotFromSlot)
+{
+    using SignalType = comp::Signal<void()>;
+    SignalType signal;
+
+    comp::Connection connection;
+    auto slot = [&connection]()
+    {
+        connection.disconnect();
+    };
+    signal.connect(slot);
+    connection = signal.connect(&function);
+    EXPECT_EQ(1, signal().size());
+    EXPECT_EQ(0, functionCallCount);
+    EXPECT_FALSE(connection);
+    EXPECT_EQ(1, signal().size());
+}
+
+// The application developer can allocate the slots and the trackers of a signal from a memory resource.
+TEST_F(SignalTest, connectWithMemoryResource)
+{
+    CountingResource::allocationCount = 0;
+    CountingResource::deallocationCount = 0;
+    {
+        comp::Signal<void()> signal;
+        signal.setMemoryResource(comp::make_intrusive<CountingResource>());
+        auto object = comp::make_shared<Object1>();
+
+        auto connection1 = signal.connect(&function);
+        auto connection2 = signal.connect(object, &Object1::methodWithNoArg);
+        // Two slots, the method slot checks its receiver without a tracker.
+        EXPECT_EQ(2, CountingResource::allocationCount);
+        EXPECT_EQ(2u, signal().size());
+
+        // The first tracker is held in the slot, the trackers that do not fit the slot are allocated from the
+        // resource.
+        auto tracker1 = comp::make_shared<Object1>();
+        auto tracker2 = comp::make_shared<Object1>();
+        connection2.bind(tracker1);
+        EXPECT_EQ(2, CountingResource::allocationCount);
+        connection2.bind(tracker2);
+        EXPECT_EQ(3, CountingResource::allocationCount);
+    }
+    EXPECT_EQ(3, CountingResource::deallocationCount);
+}
+
+// The first tracker bound to a slot is held in the slot, for any tracker type and any slot type. The other
+// trackers are allocated from the memory resource of the signal.
+TEST_F(SignalTest, bindTrackersWithMemoryResource)
+{
+    CountingResource::allocationCount = 0;
+    CountingResource::deallocationCount = 0;
+    {
+        comp::Signal<void()> signal;
+        signal.setMemoryResource(comp::make_intrusive<CountingResource>());
+        auto object = comp::make_shared<Object1>();
+        auto sharedTracker = comp::make_shared<Object1>();
+        auto sharedConnectionTracker = comp::make_shared<comp::ConnectionTracker>();
+        comp::ConnectionTracker connectionTracker;
+
+        auto lambdaConnection1 = signal.connect([]() {}).bind(&connectionTracker);
+        auto lambdaConnection2 = signal.connect([]() {}).bind(sharedTracker);
+        auto lambdaConnection3 = signal.connect([]() {}).bind(sharedConnectionTracker);
+        auto methodConnection1 = signal.connect(object, &Object1::methodWithNoArg).bind(&connectionTracker);
+        auto methodConnection2 = signal.connect(object, &Object1::methodWithNoArg).bind(sharedTracker);
+        // Five slots, the trackers are held in the slots.
+        EXPECT_EQ(5, CountingResource::allocationCount);
+
+        lambdaConnection1.bind(sharedTracker);
+        methodConnection2.bind(&connectionTracker);
+        EXPECT_EQ(7, CountingResource::allocationCount);
+        EXPECT_EQ(5u, signal().size());
+    }
+    EXPECT_EQ(7, CountingResource::deallocationCount);
+}
+
+// The disconnected slots of a signal are released without emitting the signal.
+TEST_F(SignalTest, disconnectedSlotsReleasedWithoutEmit)
+{
+    CountingResource::allocationCount = 0;
+    CountingResource::deallocationCount = 0;
+
+    comp::Signal<void()> signal;
+    signal.setMemoryResource(comp::make_intrusive<CountingResource>());
+    {
+        std::vector<comp::Connection> connections;
+        for (auto i = 0; i < 10; ++i)
+        {
+            connections.push_back(signal.connect([]() {}));
+        }
+        for (auto& connection : connections)
+        {
+            connection.disconnect();
+        }
+    }
+    EXPECT_EQ(10, CountingResource::allocationCount);
+    EXPECT_EQ(10, CountingResource::deallocationCount);
+    EXPECT_EQ(0u, signal().size());
+}
+
+// The connection does not keep the slot alive. The slot is destroyed once the signal releases it, while the block
+// of the slot is released with the last connection.
+TEST_F(SignalTest, connectionOutlivesSlot)
+{
+    CountingResource::allocationCount = 0;
+    CountingResource::deallocationCount = 0;
+
+    comp::Signal<void()> signal;
+    signal.setMemoryResource(comp::make_intrusive<CountingResource>());
+    auto captured = comp::make_shared<int>(0);
+    auto connection = signal.connect([captured]() {});
+    auto copy = connection;
+    EXPECT_EQ(sizeof(void*), sizeof(connection));
+    EXPECT_EQ(2, captured.use_count());
+
+    connection.disconnect();
+    EXPECT_EQ(1, captured.use_count());
+    EXPECT_FALSE(connection);
+    EXPECT_FALSE(connection.get());
+    EXPECT_EQ(copy, connection);
+    EXPECT_EQ(0, CountingResource::deallocationCount);
+
+    connection = comp::Connection();
+    EXPECT_EQ(0, CountingResource::deallocationCount);
+    copy = comp::Connection();
+    EXPECT_EQ(1, CountingResource::deallocationCount);
+}
+
 // When the application developer destroys the object of a method that is a slot of a signal connection,
 // the connections in which the object is found are invalidated.
 TEST_F(SignalTest, signalsConnectedToAnObjectThatGetsDeleted)
@@ -336,6 +795,36 @@ TEST_F(SignalTest, signalsConnectedToAnObjectThatGetsDeleted)
     EXPECT_FALSE(connection2);
     EXPECT_FALSE(connection3);
 }
+// When the receiver of a slot is destroyed, the slot is disconnected and its result is not collected.
+TEST_F(SignalTest, slotWithExpiredReceiver)
+{
+    comp::Signal<int()> signal;
+    signal.connect([]() { return 1; });
+    auto connection = signal.addSlot(comp::core::Slot<comp::mutex>::create<ExpiredReceiverSlot>(nullptr, signal));
+    signal.connect([]() { return 2; });
+
+    EXPECT_TRUE(connection);
+    auto results = signal();
+    EXPECT_EQ((std::vector<int>{1, 2}), static_cast<std::vector<int>&>(results));
+    EXPECT_FALSE(connection);
+}
+
+// A slot that throws bad_weak_ptr or bad_slot, for example by locking a receiver that is being destroyed, is
+// disconnected, and the emission continues with the next slot.
+TEST_F(SignalTest, slotThrowingBadWeakPtrIsDisconnected)
+{
+    comp::Signal<int()> signal;
+    auto connection1 = signal.connect([]() -> int { throw comp::bad_weak_ptr(); });
+    auto connection2 = signal.connect([]() -> int { throw comp::bad_slot(); });
+    signal.connect([]() { return 3; });
+
+    auto results = signal();
+    EXPECT_EQ((std::vector<int>{3}), static_cast<std::vector<int>&>(results));
+    EXPECT_FALSE(connection1);
+    EXPECT_FALSE(connection2);
+    EXPECT_EQ(1u, signal().size());
+}
+
 TEST_F(SignalTest, signalsConnectedToAnObjectThatGetsDeleted_noConenctionHolding)
 {
     using SignalType = comp::Signal<void()>;
@@ -473,8 +962,8 @@ public:
 
 TEST_F(SignalTest, pairNotifyDestruction)
 {
-    auto server = comp::make_shared<Base, Server>();
-    auto client = comp::make_shared<Base, Client>();
+    comp::shared_ptr<Base> server = comp::make_shared<Server>();
+    comp::shared_ptr<Base> client = comp::make_shared<Client>();
     EXPECT_EQ(1, server.use_count());
     EXPECT_EQ(0, server->m_pair.use_count());
 
@@ -491,6 +980,66 @@ TEST_F(SignalTest, pairNotifyDestruction)
     EXPECT_EQ(0, server->m_pair.use_count());
 }
 
+// The application developer can emit a batch of events. Each slot is activated with all the events before
+// the next slot.
+TEST_F(SignalTest, emitBatch)
+{
+    comp::Signal<void(int)> signal;
+    std::vector<std::string> activations;
+    signal.connect([&activations](int value) { activations.push_back("a" + std::to_string(value)); });
+    signal.connect([&activations](int value) { activations.push_back("b" + std::to_string(value)); });
+
+    const std::vector<std::tuple<int>> events = {{1}, {2}, {3}};
+    EXPECT_EQ(6u, signal.emitBatch(events).size());
+    EXPECT_EQ((std::vector<std::string>{"a1", "a2", "a3", "b1", "b2", "b3"}), activations);
+    EXPECT_EQ(0u, signal.emitBatch({}).size());
+}
+
+// The slot that gets disconnected during a batch emission is not activated with the rest of the events.
+TEST_F(SignalTest, disconnectDuringEmitBatch)
+{
+    comp::Signal<void(int)> signal;
+    auto tracker = comp::make_shared<int>(0);
+    signal.connect([](comp::Connection connection, int value)
+    {
+        ++functionCallCount;
+        if (value == 2)
+        {
+            connection.disconnect();
+        }
+    });
+    auto tracked = signal.connect(&SignalTest::functionWithIntArgument).bind(tracker);
+    tracker.reset();
+
+    const std::vector<std::tuple<int>> events = {{1}, {2}, {3}};
+    EXPECT_EQ(2u, signal.emitBatch(events).size());
+    EXPECT_EQ(2u, functionCallCount);
+    EXPECT_EQ(0u, intValue);
+    EXPECT_FALSE(tracked);
+}
+
+// The application developer can connect a slot that receives the events of a batch emission in one call.
+TEST_F(SignalTest, connectBatch)
+{
+    comp::Signal<void(int, std::string)> signal;
+    std::vector<size_t> batchSizes;
+    std::string texts;
+    signal.connectBatch([&batchSizes, &texts](comp::signal_batch_t<int, std::string> events)
+    {
+        batchSizes.push_back(events.size());
+        for (auto& event : events)
+        {
+            texts += std::get<1>(event);
+        }
+    });
+
+    const std::vector<std::tuple<int, std::string>> events = {{1, "a"}, {2, "b"}, {3, "c"}};
+    EXPECT_EQ(3u, signal.emitBatch(events).size());
+    EXPECT_EQ(1u, signal(4, "d").size());
+    EXPECT_EQ((std::vector<size_t>{3u, 1u}), batchSizes);
+    EXPECT_EQ("abcd", texts);
+}
+
 class TestEmitWithCollector : public SignalTest
 {
 public:
@@ -543,6 +1092,29 @@ public:
     };
 };
 
+// The collectors receive a view of the connection of each slot, which converts to the connection of the slot.
+TEST_F(TestEmitWithCollector, collectConnectionViews)
+{
+    class Connections : public comp::Collector<Connections>, public comp::vector<comp::Connection>
+    {
+    public:
+        bool handleResult(comp::ConnectionView view, int)
+        {
+            EXPECT_TRUE(view);
+            push_back(view);
+            return true;
+        }
+    };
+
+    comp::Signal<int()> signal;
+    auto first = signal.connect([]() { return 1; });
+    auto second = signal.connect([]() { return 2; });
+    auto collector = signal.operator()<Connections>();
+    ASSERT_EQ(2u, collector.size());
+    EXPECT_EQ(first, collector[0]);
+    EXPECT_EQ(second, collector[1]);
+}
+
 // The application developer should be able to use emit contexts to accumulate the results of the slots connected to a signal
 // that has a return value.
 TEST_F(TestEmitWithCollector, accumulateResults)
@@ -579,6 +1151,17 @@ TEST_F(TestEmitWithCollector, summResults_MemberSignal)
     EXPECT_EQ(11, collector.grandTotal);
 }
 
+// The application developer can collect the results of a batch emission, grouped by slot.
+TEST_F(TestEmitWithCollector, batchResults)
+{
+    const std::vector<std::tuple<>> events(2u);
+    auto collector = intSignal.emitBatch<Accumulate>(events);
+    EXPECT_EQ((std::vector<int>{1, 1, 10, 10}), static_cast<const std::vector<int>&>(collector));
+
+    auto memberCollector = object->intSignal.emitBatch<Summ>(events);
+    EXPECT_EQ(22, memberCollector.grandTotal);
+}
+
 TEST_F(SignalTest, signal2)
 {
     auto object = comp::make_shared<Object1>();
@@ -0,0 +1,104 @@
+#include "test_base.hpp"
+#include <comp/static_signal.hpp>
+
+namespace
+{
+
+int one()
+{
+    return 1;
+}
+
+int ten()
+{
+    return 10;
+}
+
+int twice(int value)
+{
+    return value * 2;
+}
+
+class Summ : public comp::Collector<Summ>
+{
+public:
+    bool handleResult(comp::Connection, int result)
+    {
+        grandTotal += result;
+        return true;
+    }
+    int grandTotal = 0;
+};
+
+}
+
+class StaticSignalTest : public SignalTest
+{
+};
+
+// The application developer can declare a static signal with functions.
+TEST_F(StaticSignalTest, toFunction)
+{
+    comp::StaticSignal<void(), &SignalTest::function, &SignalTest::function> signal;
+    EXPECT_EQ(2u, signal.size());
+    EXPECT_EQ(2u, signal().size());
+    EXPECT_EQ(2u, functionCallCount);
+}
+
+// The application developer can declare a static signal with arguments.
+TEST_F(StaticSignalTest, withArguments)
+{
+    comp::StaticSignal<void(int, std::string), &SignalTest::functionWithIntAndStringArgument> signal;
+    signal(15, "alpha");
+    EXPECT_EQ(15u, intValue);
+    EXPECT_EQ("alpha", stringValue);
+}
+
+// The application developer can declare a static signal with reference arguments.
+TEST_F(StaticSignalTest, withRefArgument)
+{
+    comp::StaticSignal<void(int&), &SignalTest::functionWithIntRefArgument> signal;
+    int ivalue = 10;
+    signal(ivalue);
+    EXPECT_EQ(10u, intValue);
+    EXPECT_EQ(20, ivalue);
+}
+
+// The application developer can declare a static signal without slots.
+TEST_F(StaticSignalTest, withoutSlots)
+{
+    comp::StaticSignal<void(int)> signal;
+    EXPECT_EQ(0u, signal.size());
+    EXPECT_EQ(0u, signal(1).size());
+}
+
+// The application developer can collect the results of a static signal with the default collector.
+TEST_F(StaticSignalTest, defaultCollector)
+{
+    comp::StaticSignal<int(), &one, &ten> signal;
+    auto results = signal();
+    EXPECT_EQ((std::vector<int>{1, 10}), static_cast<std::vector<int>&>(results));
+}
+
+// The application developer can collect the results of a static signal with a custom collector.
+TEST_F(StaticSignalTest, customCollector)
+{
+    comp::StaticSignal<int(int), &twice, &twice, &twice> signal;
+    EXPECT_EQ(30, signal.operator()<Summ>(5).grandTotal);
+}
+
+// When the collector of a static signal returns false, the remaining slots are not invoked.
+TEST_F(StaticSignalTest, collectorBreaks)
+{
+    comp::StaticSignal<int(), &one, &ten> signal;
+    EXPECT_EQ((std::vector<int>{1}), signal.operator()<FirstOnly>().results);
+}
+
+#if __cplusplus >= 202002L
+// The application developer can declare a static signal with captureless lambdas.
+TEST_F(StaticSignalTest, lambdas)
+{
+    comp::StaticSignal<int(int), [](int value) { return value + 1; }, [](int value) { return value * 3; }> signal;
+    EXPECT_EQ(13, signal.operator()<Summ>(3).grandTotal);
+}
+#endif
@@ -1,6 +1,9 @@
 #include "test_base.hpp"
 #include <comp/signal.hpp>
 #include <comp/utility/tracker.hpp>
+#include <atomic>
+#include <thread>
+#include <vector>
 
 namespace
 {
@@ -111,6 +114,22 @@ TEST_F(TrackerTest, connectToTrackableAndWeakPointer)
     EXPECT_FALSE(connection);
 }
 
+// The application developer should be able to untrack a connection. The untracked connection is not disconnected
+// when the tracker clears its trackables.
+TEST_F(TrackerTest, untrackConnection)
+{
+    using SignalType = comp::Signal<void()>;
+    TestTracker tracker;
+    SignalType signal;
+
+    auto connection1 = signal.connect([](){}).bind(&tracker);
+    auto connection2 = signal.connect([](){}).bind(&tracker);
+    tracker.untrack(connection2);
+    tracker.clearTrackables();
+    EXPECT_FALSE(connection1);
+    EXPECT_TRUE(connection2);
+}
+
 // The application developer should be able to track multiple slots with the same tracker.
 TEST_F(TrackerTest, bindTrackerToMultipleSignals)
 {
@@ -283,3 +302,109 @@ TEST_F(TrackerTest, deleteOneFromTrackablesInSlotDisconnects_intrusiveTrackerPtr
     EXPECT_FALSE(connection);
     EXPECT_EQ(1, signal().size());
 }
+
+// The application developer can untrack the connections of a tracker in any order. The tracker disconnects the
+// connections that are still tracked.
+TEST_F(TrackerTest, untrackConnectionsInAnyOrder)
+{
+    using SignalType = comp::Signal<void()>;
+    TestTracker tracker;
+    SignalType signal;
+
+    std::vector<comp::Connection> connections;
+    for (auto i = 0; i < 6; ++i)
+    {
+        connections.push_back(signal.connect([](){}));
+        tracker.track(connections.back());
+    }
+    tracker.untrack(connections[0]);
+    tracker.untrack(connections[3]);
+    tracker.untrack(connections[5]);
+    tracker.clearTrackables();
+
+    EXPECT_TRUE(connections[0]);
+    EXPECT_FALSE(connections[1]);
+    EXPECT_FALSE(connections[2]);
+    EXPECT_TRUE(connections[3]);
+    EXPECT_FALSE(connections[4]);
+    EXPECT_TRUE(connections[5]);
+    EXPECT_EQ(3u, signal().size());
+}
+
+// The disconnected slots are untracked by their trackers, so the tracker only disconnects the connected slots.
+TEST_F(TrackerTest, disconnectUntracksConnection)
+{
+    using SignalType = comp::Signal<void()>;
+    auto tracker = comp::make_unique<TestTracker>();
+    SignalType signal;
+
+    auto connection1 = signal.connect([](){}).bind(tracker.get());
+    auto connection2 = signal.connect([](){}).bind(tracker.get());
+    connection1.disconnect();
+    EXPECT_EQ(1u, signal().size());
+
+    // The disconnected slot is released, while the tracker tracks the connected one.
+    tracker.reset();
+    EXPECT_FALSE(connection2);
+    EXPECT_EQ(0u, signal().size());
+}
+
+// The trackers that do not fit the storage of the slot are allocated, and tracked the same way.
+TEST_F(TrackerTest, bindMoreTrackersThanFitInSlot)
+{
+    using SignalType = comp::Signal<void()>;
+    TestTracker tracker1;
+    TestTracker tracker2;
+    SignalType signal;
+    std::vector<comp::shared_ptr<Object>> objects;
+    for (auto i = 0; i < 4; ++i)
+    {
+        objects.push_back(comp::make_shared<Object>());
+    }
+
+    auto connection = signal.connect([](){}).bind(&tracker1, objects[0], objects[1], &tracker2, objects[2], objects[3]);
+    EXPECT_TRUE(connection);
+
+    tracker1.untrack(connection);
+    EXPECT_TRUE(connection);
+    objects[3].reset();
+    EXPECT_FALSE(connection);
+    EXPECT_EQ(0u, signal().size());
+}
+
+#ifdef COMP_CONFIG_THREAD_ENABLED
+// The connection polls its trackers without locking the slot, while other threads bind and untrack trackers.
+TEST_F(TrackerTest, pollTrackersWhileUntracking)
+{
+    using SignalType = comp::Signal<void()>;
+    SignalType signal;
+    auto object = comp::make_shared<Object>();
+    auto connection = signal.connect([](){}).bind(object);
+
+    std::atomic_bool done = false;
+    std::atomic_int errorCount = 0;
+    std::thread poller([&connection, &done, &errorCount]()
+    {
+        while (!done)
+        {
+            if (!connection)
+            {
+                ++errorCount;
+            }
+        }
+    });
+    for (auto i = 0; i < 1000; ++i)
+    {
+        TestTracker tracker1;
+        TestTracker tracker2;
+        connection.bind(&tracker1, &tracker2);
+        tracker1.untrack(connection);
+        tracker2.untrack(connection);
+    }
+    done = true;
+    poller.join();
+
+    EXPECT_EQ(0, errorCount);
+    EXPECT_TRUE(connection);
+}
+#endif